@@ -0,0 +1,97 @@
+#
+# Created by bruno on 16/10/2026.
+#
+# Integração do cpp-serializer-gen com o build:
+#
+#   include(cmake/CppSerializer.cmake)
+#   cpp_serializer_generate(TARGET app
+#                           HEADERS src/Usuario.h src/Pedido.h
+#                           [PROJECT_DIR src]
+#                           [OPTIONS --non-intrusive --out-of-line ...])
+#
+# Os arquivos gerados viram fontes do TARGET. O gerador recebe --depfile e
+# --manifest: o Ninja/Make só o rodam de novo quando um header lido muda, e
+# como o gerador só regrava o que mudou, só recompilam os objetos que
+# incluem a classe alterada. Nomes das classes saem da macro
+# SERIALIZABLE(Classe) dos HEADERS; ao criar ou remover uma classe, rode o
+# CMake de novo (como ao criar um .cpp).
+#
+# O executável é o alvo cpp_serializer (add_subdirectory) ou, sem ele, o
+# que find_program achar (CPP_SERIALIZER_EXECUTABLE).
+
+function(cpp_serializer_generate)
+    cmake_parse_arguments(PARSE_ARGV 0 CSG "" "TARGET;PROJECT_DIR" "HEADERS;OPTIONS")
+
+    if(NOT CSG_TARGET)
+        message(FATAL_ERROR "cpp_serializer_generate: TARGET é obrigatório")
+    endif()
+    if(NOT CSG_HEADERS)
+        message(FATAL_ERROR "cpp_serializer_generate: HEADERS é obrigatório")
+    endif()
+    if(NOT CSG_PROJECT_DIR)
+        set(CSG_PROJECT_DIR "${CMAKE_CURRENT_SOURCE_DIR}")
+    endif()
+    cmake_path(ABSOLUTE_PATH CSG_PROJECT_DIR NORMALIZE)
+
+    if(TARGET cpp_serializer)
+        set(generator "$<TARGET_FILE:cpp_serializer>")
+        set(generator_depends cpp_serializer)
+    else()
+        find_program(CPP_SERIALIZER_EXECUTABLE NAMES cpp_serializer cpp-serializer-gen REQUIRED)
+        set(generator "${CPP_SERIALIZER_EXECUTABLE}")
+        set(generator_depends "${CPP_SERIALIZER_EXECUTABLE}")
+    endif()
+
+    # O gerador sempre escreve em <projeto>/generated_serializers
+    set(generated_dir "${CSG_PROJECT_DIR}/generated_serializers")
+    set(work_dir "${CMAKE_CURRENT_BINARY_DIR}/cpp_serializer")
+    set(manifest "${work_dir}/${CSG_TARGET}.manifest.json")
+    set(depfile "${work_dir}/${CSG_TARGET}.d")
+
+    set(out_of_line FALSE)
+    if("--out-of-line" IN_LIST CSG_OPTIONS)
+        set(out_of_line TRUE)
+    endif()
+
+    set(headers "")
+    set(header_dirs "")
+    set(outputs "")
+    foreach(header IN LISTS CSG_HEADERS)
+        cmake_path(ABSOLUTE_PATH header BASE_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}" NORMALIZE)
+        list(APPEND headers "${header}")
+        cmake_path(GET header PARENT_PATH header_dir)
+        list(APPEND header_dirs "${header_dir}")
+
+        file(STRINGS "${header}" macros REGEX "^[ \t]*SERIALIZABLE[ \t]*\\([ \t]*[A-Za-z_][A-Za-z0-9_]*[ \t]*\\)")
+        foreach(macro IN LISTS macros)
+            string(REGEX REPLACE "^[ \t]*SERIALIZABLE[ \t]*\\([ \t]*([A-Za-z_][A-Za-z0-9_]*).*$" "\\1" class_name "${macro}")
+            list(APPEND outputs "${generated_dir}/${class_name}_serialization_impl.h")
+            if(out_of_line)
+                list(APPEND outputs "${generated_dir}/${class_name}_serialization.cpp")
+            endif()
+        endforeach()
+    endforeach()
+
+    if(NOT outputs)
+        message(WARNING "cpp_serializer_generate: nenhum SERIALIZABLE(Classe) nos HEADERS de ${CSG_TARGET}")
+    endif()
+
+    # O manifesto é a saída (alvo do depfile, gravado por último, sempre com data nova). Os
+    # arquivos gerados são BYPRODUCTS: só ficam mais novos quando o conteúdo muda, e só então
+    # recompilam quem os inclui
+    add_custom_command(
+        OUTPUT "${manifest}"
+        BYPRODUCTS ${outputs}
+        COMMAND "${generator}" ${CSG_OPTIONS} --depfile "${depfile}" --manifest "${manifest}" "${CSG_PROJECT_DIR}"
+        DEPENDS ${headers} ${generator_depends}
+        DEPFILE "${depfile}"
+        WORKING_DIRECTORY "${CSG_PROJECT_DIR}"
+        COMMENT "cpp-serializer-gen: ${CSG_TARGET}"
+        VERBATIM
+    )
+
+    target_sources(${CSG_TARGET} PRIVATE "${manifest}" ${outputs})
+    # Os arquivos gerados incluem o header da classe pelo nome ("Usuario.h")
+    list(REMOVE_DUPLICATES header_dirs)
+    target_include_directories(${CSG_TARGET} PRIVATE "${generated_dir}" ${header_dirs})
+endfunction()
@@ -0,0 +1,123 @@
+//
+// Created by bruno on 16/10/2026.
+//
+#include <fstream>
+#include <set>
+
+#include "include/BuildManifest.h"
+#include "include/JsonWriter.h"
+
+namespace fs = std::filesystem;
+
+namespace serializer {
+    namespace {
+        fs::path normalize(const fs::path& path) {
+            std::error_code ec;
+            const fs::path absolute = fs::absolute(path, ec);
+            return (ec ? path : absolute).lexically_normal();
+        }
+
+        // Escapes do formato make: espaço, '#' e '$' (o Ninja lê o mesmo formato)
+        void appendDepfilePath(std::string& out, const fs::path& path) {
+            for (const char c : path.generic_string()) {
+                if (c == ' ' || c == '#') {
+                    out += '\\';
+                } else if (c == '$') {
+                    out += '$';
+                }
+                out += c;
+            }
+        }
+
+        void writePaths(JsonWriter& out, const std::vector<fs::path>& paths) {
+            out.beginArray();
+            for (const auto& path : paths) {
+                out.value(path.generic_string());
+            }
+            out.endArray();
+        }
+    }
+
+    void BuildManifest::add(Entry entry) {
+        entry.header = normalize(entry.header);
+        for (auto& dependency : entry.dependencies) dependency = normalize(dependency);
+        for (auto& output : entry.outputs) output = normalize(output);
+        entries_.push_back(std::move(entry));
+    }
+
+    std::string BuildManifest::toJson() const {
+        std::string buffer;
+        JsonWriter out(buffer);
+
+        out.beginObject();
+        out.key("generator");
+        out.value(std::string_view("cpp-serializer-gen"));
+        out.key("classes");
+        out.beginArray();
+        for (const auto& entry : entries_) {
+            out.beginObject();
+            out.key("name");
+            out.value(entry.className);
+            out.key("header");
+            out.value(entry.header.generic_string());
+            out.key("dependencies");
+            writePaths(out, entry.dependencies);
+            out.key("outputs");
+            writePaths(out, entry.outputs);
+            out.endObject();
+        }
+        out.endArray();
+        out.endObject();
+
+        buffer += '\n';
+        return buffer;
+    }
+
+    std::string BuildManifest::toDepfile(const std::vector<fs::path>& targets) const {
+        // Cada header aparece uma vez, mesmo sendo dependência de várias classes
+        std::set<fs::path> headers;
+        for (const auto& entry : entries_) {
+            headers.insert(entry.header);
+            headers.insert(entry.dependencies.begin(), entry.dependencies.end());
+        }
+
+        std::string out;
+        for (size_t i = 0; i < targets.size(); ++i) {
+            if (i > 0) out += ' ';
+            appendDepfilePath(out, normalize(targets[i]));
+        }
+        out += ':';
+        for (const auto& header : headers) {
+            out += " \\\n  ";
+            appendDepfilePath(out, header);
+        }
+        out += '\n';
+        return out;
+    }
+
+    std::vector<fs::path> BuildManifest::outputs() const {
+        std::vector<fs::path> all;
+        for (const auto& entry : entries_) {
+            all.insert(all.end(), entry.outputs.begin(), entry.outputs.end());
+        }
+        return all;
+    }
+
+    bool BuildManifest::write(const fs::path& path, const std::string& content) {
+        std::error_code ec;
+        if (path.has_parent_path()) {
+            fs::create_directories(path.parent_path(), ec);
+        }
+
+        fs::path temporary = path;
+        temporary += ".tmp";
+        {
+            std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+            if (!stream.write(content.data(), static_cast<std::streamsize>(content.size()))) {
+                return false;
+            }
+        }
+        fs::rename(temporary, path, ec);
+        return !ec;
+    }
+}
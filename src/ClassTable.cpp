@@ -0,0 +1,82 @@
+//
+// Created by bruno on 16/10/2026.
+//
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+#include "include/ClassTable.h"
+
+namespace serializer {
+    ClassId ClassTable::add(ClassInfo classInfo, std::filesystem::path header) {
+        const std::string_view name = intern(classInfo.name);
+
+        if (const auto it = byName_.find(name); it != byName_.end()) {
+            Slot& slot = slots_[it->second];
+            slot.info = std::move(classInfo);
+            slot.header = std::move(header);
+            return it->second;
+        }
+
+        ClassId id;
+        if (!freeSlots_.empty()) {
+            id = freeSlots_.back();
+            freeSlots_.pop_back();
+        } else {
+            id = static_cast<ClassId>(slots_.size());
+            slots_.emplace_back();
+        }
+
+        Slot& slot = slots_[id];
+        slot.info = std::move(classInfo);
+        slot.header = std::move(header);
+        slot.live = true;
+
+        byName_.emplace(name, id);
+        order_.push_back(id);
+        return id;
+    }
+
+    void ClassTable::remove(ClassId id) {
+        if (id >= slots_.size() || !slots_[id].live) {
+            return;
+        }
+
+        Slot& slot = slots_[id];
+        byName_.erase(slot.info.name);
+        std::erase(order_, id);
+
+        // Libera a memória dos campos já; o slot fica para o próximo add
+        slot.info = ClassInfo();
+        slot.header.clear();
+        slot.live = false;
+        freeSlots_.push_back(id);
+    }
+
+    ClassId ClassTable::find(std::string_view name) const {
+        const auto it = byName_.find(name);
+        return it != byName_.end() ? it->second : NONE;
+    }
+
+    void ClassTable::sortByHeader() {
+        std::ranges::sort(order_, [this](ClassId a, ClassId b) {
+            return std::tie(slots_[a].header, slots_[a].info.name) <
+                   std::tie(slots_[b].header, slots_[b].info.name);
+        });
+    }
+
+    std::string_view ClassTable::intern(std::string_view text) {
+        if (const auto it = strings_.find(text); it != strings_.end()) {
+            return *it;
+        }
+
+        // A arena só cresce: as views internadas nunca são invalidadas
+        auto* data = static_cast<char*>(arena_.allocate(text.size() + 1, 1));
+        std::memcpy(data, text.data(), text.size());
+        data[text.size()] = '\0';
+
+        const std::string_view stored(data, text.size());
+        strings_.insert(stored);
+        return stored;
+    }
+}
@@ -7,8 +7,12 @@
 #include <sstream>
 #include <iostream>
 #include <algorithm>
+#include <map>
 #include <set>
+#include <unordered_map>
 
+#include "include/Parser.h"
+#include "include/SourceFile.h"
 #include "include/TypeChecker.h"
 #include "include/Utils.h"
 
@@ -41,11 +45,85 @@ namespace serializer {
             auto end = str.find_last_not_of(" \t");
             return str.substr(start, end - start + 1);
         }
+
+        // Delimitam as declarações que o gerador insere na classe: cada execução substitui o bloco
+        constexpr std::string_view DECLARATIONS_BEGIN =
+            "// Serialização (gerado por cpp-serializer-gen, não edite até o fim do bloco)";
+        constexpr std::string_view DECLARATIONS_END = "// Fim da serialização gerada";
+
+        // Bloco das versões sem marcador de fim: só este título, e as declarações até o '}' da classe
+        constexpr std::string_view LEGACY_DECLARATIONS_BEGIN = "// Serialização";
+
+        /**
+         * Procura uma linha que, sem a indentação, é exatamente text
+         * @return Posição do início da linha, ou npos
+         */
+        size_t findLine(std::string_view content, std::string_view text, size_t from, size_t to) {
+            for (size_t pos = content.find(text, from); pos != std::string_view::npos && pos < to;
+                 pos = content.find(text, pos + 1)) {
+                const size_t newline = content.rfind('\n', pos);
+                const size_t lineStart = newline == std::string_view::npos ? 0 : newline + 1;
+                const size_t after = pos + text.size();
+                const bool indentOnly = content.substr(lineStart, pos - lineStart).find_first_not_of(" \t") ==
+                                        std::string_view::npos;
+                const bool endsLine = after == content.size() || content[after] == '\n' || content[after] == '\r';
+                if (indentOnly && endsLine) {
+                    return lineStart;
+                }
+            }
+            return std::string_view::npos;
+        }
+
+        /**
+         * Fim do bloco antigo: as linhas seguidas ao título que o gerador escrevia
+         * (comentários, "template<typename Archive>" e declarações de método). Para
+         * na primeira outra linha, para não apagar membros escritos depois do bloco
+         * @return Posição logo após a última linha do bloco
+         */
+        size_t legacyBlockEnd(std::string_view content, size_t begin, size_t bodyEnd) {
+            size_t end = content.find('\n', begin);
+            while (end != std::string_view::npos && end < bodyEnd) {
+                const size_t next = content.find('\n', end + 1);
+                const size_t lineEnd = next == std::string_view::npos ? bodyEnd : std::min(next, bodyEnd);
+                std::string_view line = content.substr(end + 1, lineEnd - end - 1);
+                const size_t first = line.find_first_not_of(" \t");
+                const size_t last = line.find_last_not_of(" \t\r");
+                if (first == std::string_view::npos) break;
+                line = line.substr(first, last - first + 1);
+
+                const bool generated = line.starts_with("//") || line == "template<typename Archive>" ||
+                                       (line.find('(') != std::string_view::npos && line.ends_with(';'));
+                if (!generated || next == std::string_view::npos || next >= bodyEnd) break;
+                end = next;
+            }
+            return end == std::string_view::npos ? bodyEnd : end + 1;
+        }
+
+        bool isSequenceContainer(const std::string& base) {
+            return base == "std::vector" || base == "std::list" || base == "std::deque" ||
+                   base == "std::pmr::vector" || base == "std::pmr::list" || base == "std::pmr::deque";
+        }
+
+        // "a::b" para a classe declarada em namespace a { namespace b { ... } }
+        std::string namespaceOf(const ClassInfo& classInfo) {
+            std::string result;
+            for (const auto& ns : classInfo.namespaces) {
+                if (!result.empty()) result += "::";
+                result += ns;
+            }
+            return result;
+        }
+
+        bool isMapContainer(const std::string& base) {
+            return base == "std::map" || base == "std::unordered_map" ||
+                   base == "std::pmr::map" || base == "std::pmr::unordered_map";
+        }
     }
 
     CodeGenerator::CodeGenerator() {
         generateJson_ = true;
         generateGeneric_ = true;
+        generateBinary_ = true;
         indentSize_ = 4;
     }
 
@@ -54,6 +132,10 @@ namespace serializer {
         const fs::path& outputDir,
         const TypeChecker& typeChecker
     ) const {
+        if (!checkReadableFields(classInfo)) {
+            return std::nullopt;
+        }
+
         // Cria diretório de saída se não existir
         std::error_code ec;
         if (!fs::exists(outputDir, ec) && !fs::create_directories(outputDir, ec)) {
@@ -66,20 +148,74 @@ namespace serializer {
         fs::path outputPath = outputDir / filename;
 
         // Gera conteúdo do arquivo
-        std::string content = generateImplContent(classInfo, typeChecker);
+        if (!writeIfChanged(outputPath, generateImplContent(classInfo, typeChecker))) {
+            return std::nullopt;
+        }
+
+        // --out-of-line: os corpos vão para o .cpp; sem ele, um .cpp antigo duplicaria as definições
+        const fs::path sourcePath = outputDir / (classInfo.name + "_serialization.cpp");
+        if (outOfLine_) {
+            if (!writeIfChanged(sourcePath, generateSourceContent(classInfo, typeChecker))) {
+                return std::nullopt;
+            }
+        } else if (fs::remove(sourcePath, ec)) {
+            std::cout << "   🗑️  Removido: " << sourcePath.filename().string() << "\n";
+        }
+
+        return outputPath;
+    }
+
+    bool CodeGenerator::checkReadableFields(const ClassInfo& classInfo) const {
+        bool readable = true;
+        for (const auto& field : classInfo.serializableFields()) {
+            if (field.type.find("string_view") != std::string::npos) {
+                std::cerr << "❌ " << classInfo.name << "::" << field.name << " (" << field.type
+                          << "): std::string_view não é dona do texto e não pode ser desserializada,"
+                          << " use std::string (ou marque o campo com TRANSIENT)\n";
+                readable = false;
+            }
+        }
+        return readable;
+    }
+
+    std::vector<fs::path> CodeGenerator::outputFiles(
+        const ClassInfo& classInfo,
+        const fs::path& outputDir
+    ) const {
+        std::vector<fs::path> files{outputDir / (classInfo.name + "_serialization_impl.h")};
+        if (outOfLine_) {
+            files.push_back(outputDir / (classInfo.name + "_serialization.cpp"));
+        }
+        return files;
+    }
+
+    bool CodeGenerator::writeIfChanged(const fs::path& path, const std::string& content) const {
+        const std::string filename = path.filename().string();
+
+        // Só reescreve se o conteúdo mudou: manter a data evita recompilar quem inclui
+        if (const auto existing = SourceFile::open(path)) {
+            stats_.bytesRead += existing->content().size();
+            if (existing->content() == content) {
+                stats_.filesUnchanged++;
+                std::cout << "   ⏭️  Sem mudanças: " << filename << "\n";
+                return true;
+            }
+        }
 
         // Escreve no arquivo
-        std::ofstream file(outputPath);
+        std::ofstream file(path);
         if (!file.is_open()) {
-            std::cerr << "❌ Erro ao criar arquivo: " << outputPath << "\n";
-            return std::nullopt;
+            std::cerr << "❌ Erro ao criar arquivo: " << path << "\n";
+            return false;
         }
 
         file << content;
         file.close();
+        stats_.filesWritten++;
+        stats_.bytesWritten += content.size();
 
         std::cout << "   ✅ Gerado: " << filename << "\n";
-        return outputPath;
+        return true;
     }
 
     bool CodeGenerator::modifyOriginalClass(
@@ -97,80 +233,61 @@ namespace serializer {
         buffer << inFile.rdbuf();
         std::string content = buffer.str();
         inFile.close();
-
-        // Verifica se já foi modificado (contém serialize())
-        if (content.find("serialize()") != std::string::npos ||
-            content.find("deserialize(") != std::string::npos) {
-            std::cout << "   ⏭️  Classe já modificada, pulando...\n";
-            return true; // Já tem os métodos
-        }
-
-        // Encontra o fim da classe (procura por "};" após a classe)
-        size_t classStart = content.find("class " + classInfo.name);
-        if (classStart == std::string::npos) {
-            // Talvez seja struct
-            classStart = content.find("struct " + classInfo.name);
-            if (classStart == std::string::npos) {
-                std::cerr << "❌ Não encontrou classe/struct: " << classInfo.name << "\n";
-                return false;
-            }
-        }
-
-        // Encontra o "};" que fecha a classe
-        size_t braceCount = 0;
-        bool inClass = false;
-        size_t classEnd = std::string::npos;
-
-        for (size_t i = classStart; i < content.size(); i++) {
-            if (content[i] == '{') {
-                braceCount++;
-                inClass = true;
-            } else if (content[i] == '}') {
-                braceCount--;
-                if (inClass && braceCount == 0) {
-                    // Encontrou o } de fechamento, agora procura o ;
-                    for (size_t j = i + 1; j < content.size(); j++) {
-                        if (content[j] == ';') {
-                            classEnd = j;
-                            break;
-                        }
-                    }
-                    break;
-                }
-            }
-        }
-
-        if (classEnd == std::string::npos) {
-            std::cerr << "❌ Não encontrou fim da classe\n";
-            return false;
-        }
-
-        // Encontra última chave antes do fechamento
-        size_t lastBrace = content.rfind('}', classEnd - 1);
-        if (lastBrace == std::string::npos) {
-            std::cerr << "❌ Estrutura da classe inválida\n";
+        stats_.bytesRead += content.size();
+
+        // O '}' que fecha a classe vem do lexer: chaves dentro de strings, comentários,
+        // enums e métodos inline não confundem a posição. Sem ele, o header fica como está
+        const auto parsed = Parser().parseClass(originalHeader, content);
+        if (!parsed || parsed->name != classInfo.name || parsed->bodyEnd == std::string::npos) {
+            std::cerr << "❌ Não encontrou o fim da classe " << classInfo.name
+                      << " com segurança, header não modificado\n";
             return false;
         }
+        const size_t bodyBegin = parsed->bodyBegin;
+        const size_t bodyEnd = parsed->bodyEnd;
 
-        // Gera declarações dos métodos
-        std::string declarations = generateMethodDeclarations(classInfo);
-
-        // Insere declarações antes do último "}" (dentro da classe)
-        std::string toInsert = "\n" + makeIndent(1, indentSize_) + "// Serialização\n";
-        std::istringstream declStream(declarations);
+        // Bloco de declarações entre os marcadores
+        const std::string indent = makeIndent(1, indentSize_);
+        std::string block = indent + std::string(DECLARATIONS_BEGIN) + "\n";
+        std::istringstream declStream(generateMethodDeclarations(classInfo));
         std::string line;
-
         while (std::getline(declStream, line)) {
             if (!line.empty()) {
-                toInsert += makeIndent(1, indentSize_) + line + "\n";
+                block += indent + line + "\n";
             }
         }
+        block += indent + std::string(DECLARATIONS_END) + "\n";
+
+        // Substitui o bloco de uma execução anterior (de qualquer versão) ou insere um novo:
+        // declarações novas (ou o --pmr ligado depois) chegam também aos headers já modificados
+        std::string updated = content;
+        if (const size_t begin = findLine(content, DECLARATIONS_BEGIN, bodyBegin, bodyEnd);
+            begin != std::string::npos) {
+            const size_t end = findLine(content, DECLARATIONS_END, begin, bodyEnd);
+            if (end == std::string::npos) {
+                std::cerr << "❌ Bloco de serialização sem \"" << DECLARATIONS_END << "\" em "
+                          << originalHeader.filename() << ", header não modificado\n";
+                return false;
+            }
+            const size_t lineEnd = content.find('\n', end);
+            updated.replace(begin, (lineEnd == std::string::npos ? content.size() : lineEnd + 1) - begin, block);
+        } else if (const size_t legacy = findLine(content, LEGACY_DECLARATIONS_BEGIN, bodyBegin, bodyEnd);
+                   legacy != std::string::npos) {
+            updated.replace(legacy, legacyBlockEnd(content, legacy, bodyEnd) - legacy, block);
+        } else if (content.substr(bodyBegin, bodyEnd - bodyBegin).find("serialize()") != std::string::npos) {
+            // Declarações escritas à mão: inserir o bloco as duplicaria
+            stats_.filesUnchanged++;
+            std::cout << "   ⏭️  Classe já declara serialize() fora do bloco gerado, pulando...\n";
+            return true;
+        } else {
+            updated.insert(bodyEnd, "\n" + block);
+        }
 
-        content.insert(lastBrace, toInsert);
-
-        // Atualiza posições após inserção
-        classEnd += toInsert.length();
-        lastBrace += toInsert.length();
+        if (updated == content) {
+            stats_.filesUnchanged++;
+            std::cout << "   ⏭️  Declarações já atualizadas\n";
+            return true;
+        }
 
         // Salva o arquivo modificado
         std::ofstream outFile(originalHeader);
@@ -179,8 +296,10 @@ namespace serializer {
             return false;
         }
 
-        outFile << content;
+        outFile << updated;
         outFile.close();
+        stats_.filesWritten++;
+        stats_.bytesWritten += updated.size();
 
         std::cout << "   ✅ Métodos adicionados à classe\n";
         return true;
@@ -200,10 +319,57 @@ namespace serializer {
         ss << "// Desserializa de JSON\n";
         ss << "void deserialize(const nlohmann::json& json);\n\n";
 
+        // Desserialização no lugar (objetos de longa duração)
+        ss << "// Desserializa reaproveitando a memória já alocada nos campos\n";
+        ss << "void deserializeInto(const nlohmann::json& json);\n\n";
+
         // Factory method
         ss << "// Cria instância a partir de JSON\n";
         ss << "[[nodiscard]] static " << classInfo.name
-           << " fromJson(const nlohmann::json& json);\n";
+           << " fromJson(const nlohmann::json& json);\n\n";
+
+        // Escrita em streaming (sem DOM intermediário)
+        ss << "// Serializa para JSON direto no writer (sem nlohmann::json intermediário)\n";
+        ss << "void serializeTo(serializer::JsonWriter& out) const;\n\n";
+        ss << "// Anexa o JSON ao final de out (buffer reutilizável)\n";
+        ss << "void writeJson(std::string& out) const;\n\n";
+
+        // Leitura em streaming (sem DOM intermediário)
+        ss << "// Desserializa direto do texto JSON (sem nlohmann::json intermediário)\n";
+        ss << "void deserializeFrom(std::string_view json);\n\n";
+        ss << "// Lê os campos a partir do reader (usado por objetos aninhados)\n";
+        ss << "void readJson(serializer::JsonReader& in);\n";
+
+        // Formato binário compacto
+        if (generateBinary_) {
+            ss << "\n";
+            ss << "// Anexa a forma binária compacta ao final de out\n";
+            ss << "void serializeBinary(std::string& out) const;\n\n";
+            ss << "// Desserializa da forma binária compacta\n";
+            ss << "void deserializeBinary(std::string_view data);\n\n";
+            ss << "// Escrita/leitura binária (usadas por objetos aninhados)\n";
+            ss << "void writeBinary(serializer::WireWriter& out) const;\n";
+            ss << "void readBinary(serializer::WireReader& in);\n\n";
+            ss << "// Tamanho exato da forma binária (para reservar o buffer uma vez só)\n";
+            ss << "[[nodiscard]] std::size_t serializedSize() const;\n";
+        }
+
+        // Alocação em arena (std::pmr)
+        if (generatePmr_) {
+            ss << "\n";
+            ss << "// Passa a alocar os campos std::pmr (e os dos objetos aninhados) em resource\n";
+            ss << "void useMemoryResource(std::pmr::memory_resource* resource);\n\n";
+            ss << "// Desserializa alocando todo o grafo de objetos em resource\n";
+            ss << "void deserialize(const nlohmann::json& json, std::pmr::memory_resource* resource);\n";
+            ss << "void deserializeFrom(std::string_view json, std::pmr::memory_resource* resource);\n";
+            if (generateBinary_) {
+                ss << "void deserializeBinary(std::string_view data, std::pmr::memory_resource* resource);\n";
+            }
+        }
+
+        ss << "\n";
+        ss << "// Limite superior do tamanho do JSON gerado por writeJson\n";
+        ss << "[[nodiscard]] std::size_t serializedJsonSize() const;\n";
 
         // Métodos genéricos (se habilitados)
         if (generateGeneric_) {
@@ -229,25 +395,131 @@ namespace serializer {
         std::string guardName = toUpper(classInfo.name) + "_SERIALIZATION_IMPL_H";
 
         ss << "// Arquivo gerado automaticamente por cpp-serializer-gen\n";
-        ss << "// Não edite manualmente - será sobrescrito\n\n";
+        ss << "// Não edite manualmente - será sobrescrito\n";
+        if (nonIntrusive_) {
+            ss << "// Modo não intrusivo: " << classInfo.sourceFile.filename().string()
+               << " não é modificado, as funções livres abaixo são achadas por ADL\n";
+        }
+        if (outOfLine_) {
+            ss << "// Só declarações: os corpos estão em " << classInfo.name << "_serialization.cpp\n";
+        }
+        ss << "\n";
 
         ss << "#ifndef " << guardName << "\n";
         ss << "#define " << guardName << "\n\n";
 
+        if (outOfLine_) {
+            // Declarações não precisam do json.hpp inteiro: o forward do nlohmann basta
+            if (generateJson_) {
+                ss << "#include <nlohmann/json_fwd.hpp>\n\n";
+            }
+            ss << "#include <vector>\n\n";
+            ss << "#include \"" << classInfo.sourceFile.filename().string() << "\"\n\n";
+
+            if (nonIntrusive_) {
+                ss << generateFreeFunctionDeclarations(classInfo);
+            } else {
+                if (generateGeneric_) {
+                    ss << "// serialize/deserialize(Archive&) são instanciados em " << classInfo.name
+                       << "_serialization.cpp para os archives do BinaryArchive.h\n\n";
+                }
+
+                // O lote colunar é livre também no modo membro
+                if (const std::string columnar = generateColumnarDeclarations(classInfo); !columnar.empty()) {
+                    const std::string namespaceName = namespaceOf(classInfo);
+                    ss << "// Lote colunar de std::vector<" << classInfo.name << "> (Columnar.h)\n";
+                    if (!namespaceName.empty()) ss << "namespace " << namespaceName << " {\n";
+                    ss << columnar;
+                    if (!namespaceName.empty()) ss << "} // namespace " << namespaceName << "\n";
+                    ss << "\n";
+                }
+            }
+
+            ss << "#endif // " << guardName << "\n";
+            return ss.str();
+        }
+
         // Includes necessários
         // Inclui o arquivo original da classe
         ss << "#include \"" << classInfo.sourceFile.filename().string() << "\"\n\n";
 
-        // Inclui dependências necessárias
-        if (!classInfo.dependencies.empty()) {
+        // Inclui dependências necessárias (no modo não intrusivo, depois das declarações)
+        const bool onlySelf = classInfo.dependencies.size() == 1 && classInfo.dependencies.count(classInfo.name);
+        if (!nonIntrusive_ && !classInfo.dependencies.empty() && !onlySelf) {
             ss << "// Includes para classes dependentes\n";
             for (const auto& dep : classInfo.dependencies) {
+                if (dep == classInfo.name) continue;   // Auto-referência: o header já foi incluído
                 // Gera include para a classe dependente (se ela estiver no mesmo diretório)
                 ss << generateIncludeForClass(dep, classInfo.sourceFile.parent_path()) << "\n";
             }
             ss << "\n";
         }
 
+        ss << generateLibraryIncludes();
+
+        // Forward declarations se necessário
+        std::string forwardDecls = generateForwardDeclarations(classInfo, typeChecker);
+        if (!forwardDecls.empty()) {
+            ss << "// Forward declarations\n";
+            ss << forwardDecls << "\n";
+        }
+
+        if (nonIntrusive_) {
+            // Declarações antes dos includes das dependências: com classes que se
+            // referenciam em ciclo, o impl da outra já enxerga as funções desta
+            ss << generateFreeFunctionDeclarations(classInfo);
+            ss << generateDependencyImplIncludes(classInfo);
+        }
+
+        ss << generateMethodBodies(classInfo, typeChecker);
+        ss << "#endif // " << guardName << "\n";
+
+        return ss.str();
+    }
+
+    std::string CodeGenerator::generateSourceContent(
+        const ClassInfo& classInfo,
+        const TypeChecker& typeChecker
+    ) const {
+        std::stringstream ss;
+
+        ss << "// Arquivo gerado automaticamente por cpp-serializer-gen\n";
+        ss << "// Não edite manualmente - será sobrescrito\n";
+        ss << "// Corpos de serialização de " << classInfo.name
+           << ": compile este arquivo junto com o projeto\n\n";
+
+        ss << "#include \"" << classInfo.name << "_serialization_impl.h\"\n\n";
+
+        // Os headers das dependências também só declaram: incluir todos é barato
+        ss << generateDependencyImplIncludes(classInfo);
+        ss << generateLibraryIncludes();
+
+        std::string forwardDecls = generateForwardDeclarations(classInfo, typeChecker);
+        if (!forwardDecls.empty()) {
+            ss << "// Forward declarations\n";
+            ss << forwardDecls << "\n";
+        }
+
+        ss << generateMethodBodies(classInfo, typeChecker);
+
+        if (!nonIntrusive_ && generateGeneric_) {
+            // Só os archives conhecidos: os corpos dos templates não ficam visíveis no header
+            ss << "// Instanciações explícitas para os archives do BinaryArchive.h\n";
+            const std::string qualified = classInfo.getNamespacedName();
+            ss << "template void " << qualified << "::serialize<serializer::BinaryOutputArchive>("
+               << "serializer::BinaryOutputArchive& ar) const;\n";
+            ss << "template void " << qualified << "::serialize<serializer::BinarySizeArchive>("
+               << "serializer::BinarySizeArchive& ar) const;\n";
+            ss << "template void " << qualified << "::deserialize<serializer::BinaryInputArchive>("
+               << "serializer::BinaryInputArchive& ar);\n";
+        }
+
+        return ss.str();
+    }
+
+    std::string CodeGenerator::generateLibraryIncludes() const {
+        std::stringstream ss;
+
         // Includes STL e bibliotecas
         ss << "// STL includes\n";
         ss << "#include <vector>\n";
@@ -256,53 +528,348 @@ namespace serializer {
         ss << "#include <optional>\n";
         ss << "#include <variant>\n";
         ss << "#include <memory>\n";  // Para smart pointers
+        if (generatePmr_) {
+            ss << "#include <memory_resource>\n";
+        }
         ss << "\n";
 
         if (generateJson_) {
-            ss << "#include <nlohmann/json.hpp>\n\n";
+            ss << "#include <nlohmann/json.hpp>\n";
+            ss << "#include \"JsonWriter.h\"\n";
+            ss << "#include \"JsonReader.h\"\n";
+            ss << "#include \"JsonDomReader.h\"\n\n";
         }
 
-        // Forward declarations se necessário
-        std::string forwardDecls = generateForwardDeclarations(classInfo, typeChecker);
-        if (!forwardDecls.empty()) {
-            ss << "// Forward declarations\n";
-            ss << forwardDecls << "\n";
+        if (generateBinary_) {
+            ss << "#include \"WireFormat.h\"\n\n";
+        }
+
+        if (generateJson_ || generateBinary_) {
+            ss << "#include \"Columnar.h\"\n\n";
+        }
+
+        if (generateGeneric_ && !nonIntrusive_) {
+            // Archives prontos para os métodos template (BinaryOutputArchive/BinaryInputArchive)
+            ss << "#include \"BinaryArchive.h\"\n\n";
+        }
+
+        return ss.str();
+    }
+
+    std::string CodeGenerator::generateDependencyImplIncludes(
+        const ClassInfo& classInfo
+    ) const {
+        // Só a auto-referência (Node com std::vector<Node>) não precisa de include
+        if (classInfo.dependencies.empty() ||
+            (classInfo.dependencies.size() == 1 && classInfo.dependencies.count(classInfo.name))) {
+            return "";
+        }
+
+        std::stringstream ss;
+        ss << "// Includes para classes dependentes (as funções de serialização delas)\n";
+        for (const auto& dep : classInfo.dependencies) {
+            if (dep == classInfo.name) continue;
+            ss << "#include \"" << dep << "_serialization_impl.h\"\n";
         }
+        ss << "\n";
+
+        return ss.str();
+    }
+
+    std::string CodeGenerator::generateMethodBodies(
+        const ClassInfo& classInfo,
+        const TypeChecker& typeChecker
+    ) const {
+        std::stringstream ss;
 
         ss << "// Implementações de serialização para: " << classInfo.name << "\n\n";
 
+        // Funções livres e definições dos membros ficam no namespace da classe
+        // ("P::serializeTo" fora de namespace geo não acharia geo::P)
+        const std::string namespaceName = namespaceOf(classInfo);
+        if (!namespaceName.empty()) ss << "namespace " << namespaceName << " {\n\n";
+
+        if (nonIntrusive_) {
+            if (generateJson_) {
+                ss << generateJsonConversionFunctions(classInfo) << "\n\n";
+                ss << generateStreamingSerializeMethods(classInfo, typeChecker) << "\n\n";
+                ss << generateStreamingDeserializeMethods(classInfo, typeChecker) << "\n\n";
+            }
+
+            if (generateBinary_) {
+                ss << generateBinaryMethods(classInfo, typeChecker) << "\n\n";
+            }
+
+            ss << generateSizeMethods(classInfo, typeChecker) << "\n\n";
+            ss << generateColumnarFunctions(classInfo);
+
+            if (!namespaceName.empty()) ss << "} // namespace " << namespaceName << "\n\n";
+            return ss.str();
+        }
+
         // Implementação do método serialize()
         if (generateJson_) {
             ss << generateSerializeMethod(classInfo, typeChecker) << "\n\n";
         }
 
+        // Implementação da escrita em streaming (serializeTo/writeJson)
+        if (generateJson_) {
+            ss << generateStreamingSerializeMethods(classInfo, typeChecker) << "\n\n";
+        }
+
         // Implementação do método deserialize()
         if (generateJson_) {
             ss << generateDeserializeMethod(classInfo, typeChecker) << "\n\n";
         }
 
+        // Implementação da leitura em streaming (deserializeFrom/readJson)
+        if (generateJson_) {
+            ss << generateStreamingDeserializeMethods(classInfo, typeChecker) << "\n\n";
+        }
+
+        // Implementação do deserializeInto() (reaproveita a memória dos campos)
+        if (generateJson_) {
+            ss << generateDeserializeIntoMethod(classInfo, typeChecker) << "\n\n";
+        }
+
         // Implementação do factory method fromJson()
         if (generateJson_) {
             ss << generateFromJsonMethod(classInfo, typeChecker) << "\n\n";
         }
 
+        // Implementação do formato binário
+        if (generateBinary_) {
+            ss << generateBinaryMethods(classInfo, typeChecker) << "\n\n";
+        }
+
+        // Tamanhos para pré-alocação (serializedSize/serializedJsonSize)
+        ss << generateSizeMethods(classInfo, typeChecker) << "\n\n";
+
+        // Sobrecargas com memory_resource
+        if (generatePmr_) {
+            ss << generatePmrMethods(classInfo, typeChecker) << "\n\n";
+        }
+
+        // Lote colunar de std::vector<Classe>: funções livres, no namespace da classe
+        ss << generateColumnarFunctions(classInfo);
+
         // Implementação dos métodos genéricos
         if (generateGeneric_) {
             ss << generateGenericMethods(classInfo) << "\n";
         }
 
-        ss << "#endif // " << guardName << "\n";
+        if (!namespaceName.empty()) ss << "} // namespace " << namespaceName << "\n\n";
+        return ss.str();
+    }
+
+    std::string CodeGenerator::generateFreeFunctionDeclarations(
+        const ClassInfo& classInfo
+    ) const {
+        std::stringstream ss;
+        const std::string namespaceName = namespaceOf(classInfo);
+
+        ss << "// Declarações das funções de serialização de " << classInfo.name << "\n";
+        if (!namespaceName.empty()) ss << "namespace " << namespaceName << " {\n\n";
+        if (generateJson_) {
+            ss << inlineSpecifier() << "void to_json(nlohmann::json& json, const " << classInfo.name << "& obj);\n";
+            ss << inlineSpecifier() << "void from_json(const nlohmann::json& json, " << classInfo.name << "& obj);\n";
+            ss << generateSignature(classInfo, "void", "serializeTo", "serializer::JsonWriter& out", true) << ";\n";
+            ss << generateSignature(classInfo, "void", "writeJson", "std::string& out", true) << ";\n";
+            ss << generateSignature(classInfo, "void", "readJson", "serializer::JsonReader& in", false) << ";\n";
+            ss << generateSignature(classInfo, "void", "deserializeFrom", "std::string_view json", false) << ";\n";
+            ss << generateSignature(classInfo, "std::size_t", "serializedJsonSize", "", true) << ";\n";
+        }
+        if (generateBinary_) {
+            ss << generateSignature(classInfo, "void", "writeBinary", "serializer::WireWriter& out", true) << ";\n";
+            ss << generateSignature(classInfo, "void", "serializeBinary", "std::string& out", true) << ";\n";
+            ss << generateSignature(classInfo, "void", "readBinary", "serializer::WireReader& in", false) << ";\n";
+            ss << generateSignature(classInfo, "void", "deserializeBinary", "std::string_view data", false) << ";\n";
+            ss << generateSignature(classInfo, "std::size_t", "serializedSize", "", true) << ";\n";
+        }
+        ss << generateColumnarDeclarations(classInfo);
+        ss << "\n";
+        if (!namespaceName.empty()) ss << "} // namespace " << namespaceName << "\n\n";
+
+        return ss.str();
+    }
+
+    std::string CodeGenerator::generateJsonConversionFunctions(
+        const ClassInfo& classInfo
+    ) const {
+        std::stringstream ss;
+
+        // Objetos aninhados e containers deles passam pelo to_json/from_json de cada classe (ADL)
+        ss << inlineSpecifier() << "void to_json(nlohmann::json& json, const " << classInfo.name << "& obj) {\n";
+        if (classInfo.getSerializableFieldCount() == 0) {
+            ss << "    json = nlohmann::json::object();\n";
+        } else {
+            ss << "    json = nlohmann::json{\n";
+            bool first = true;
+            for (const auto& field : classInfo.serializableFields()) {
+                if (!first) ss << ",\n";
+                ss << "        {\"" << field.name << "\", obj." << field.name << "}";
+                first = false;
+            }
+            ss << "\n    };\n";
+        }
+        ss << "}\n\n";
+
+        // assignFromJson reaproveita a memória dos campos (como o deserializeInto do modo membro)
+        ss << inlineSpecifier() << "void from_json(const nlohmann::json& json, " << classInfo.name << "& obj) {\n";
+        for (const auto& field : classInfo.serializableFields()) {
+            ss << "    serializer::assignFromJson(obj." << field.name
+               << ", json.at(\"" << field.name << "\"));\n";
+        }
+        ss << "}\n";
 
         return ss.str();
     }
 
+    std::string CodeGenerator::generateColumnarFunctions(
+        const ClassInfo& classInfo
+    ) const {
+        if (classInfo.getSerializableFieldCount() == 0 || (!generateJson_ && !generateBinary_)) {
+            return "";
+        }
+
+        std::stringstream ss;
+        auto fields = classInfo.serializableFields();
+        const auto member = [&classInfo](const FieldInfo& field) {
+            return "&" + classInfo.name + "::" + field.name;
+        };
+
+        // Índice de cada coluna (o JsonColumnReader exige todas) e a lista dos ponteiros para os campos
+        std::unordered_map<std::string, size_t> columnIndex;
+        std::string columnNames;
+        std::string members;
+        for (const auto& field : fields) {
+            if (!columnNames.empty()) {
+                columnNames += ", ";
+                members += ", ";
+            }
+            columnIndex.emplace(field.name, columnIndex.size());
+            columnNames += "\"" + field.name + "\"";
+            members += member(field);
+        }
+
+        if (generateJson_) {
+            ss << "// Lote colunar (JSON): um array por campo em vez de um objeto por linha\n";
+            ss << generateColumnsSignature(classInfo, "writeColumns", "serializer::JsonWriter& out", true) << " {\n";
+            ss << "    out.beginObject();\n";
+            for (const auto& field : fields) {
+                ss << "    serializer::writeColumn(out, \"" << field.name << "\", rows, " << member(field) << ");\n";
+            }
+            ss << "    out.endObject();\n";
+            ss << "}\n\n";
+
+            ss << generateColumnsSignature(classInfo, "readColumns", "serializer::JsonReader& in", false) << " {\n";
+            ss << "    serializer::JsonColumnReader<" << classInfo.name << "> columns(in, rows, {"
+               << columnNames << "});\n";
+            ss << "    in.beginObject();\n";
+            ss << "    std::string_view key;\n";
+            ss << "    while (in.nextKey(key)) {\n";
+            ss << generateKeyDispatch(
+                classInfo,
+                [&member, &columnIndex](const FieldInfo& field) {
+                    return "columns.read(" + std::to_string(columnIndex.at(field.name)) + ", " + member(field) + ");";
+                },
+                2
+            );
+            ss << "        in.skipValue();\n";
+            ss << "    }\n";
+            ss << "    columns.finish();\n";
+            ss << "}\n\n";
+        }
+
+        if (generateBinary_) {
+            ss << "// Lote colunar (binário): varint(linhas) + uma coluna por campo, na ordem de declaração\n";
+            ss << generateColumnsSignature(classInfo, "writeColumns", "serializer::WireWriter& out", true) << " {\n";
+            ss << "    out.varint(rows.size());\n";
+            for (const auto& field : fields) {
+                ss << "    serializer::writeColumn(out, rows, " << member(field) << ");\n";
+            }
+            ss << "}\n\n";
+
+            ss << generateColumnsSignature(classInfo, "readColumns", "serializer::WireReader& in", false) << " {\n";
+            // Menor largura de uma linha: limita as linhas que a mensagem pode declarar antes do resize
+            ss << "    serializer::readRowCount(in, rows, "
+               << (members.empty() ? "0" : "serializer::minRowBits(" + members + ")") << ");\n";
+            for (const auto& field : fields) {
+                ss << "    serializer::readColumn(in, rows, " << member(field) << ");\n";
+            }
+            ss << "}\n\n";
+        }
+
+        return ss.str();
+    }
+
+    std::string CodeGenerator::generateColumnarDeclarations(
+        const ClassInfo& classInfo
+    ) const {
+        if (classInfo.getSerializableFieldCount() == 0) {
+            return "";
+        }
+
+        std::stringstream ss;
+        if (generateJson_) {
+            ss << generateColumnsSignature(classInfo, "writeColumns", "serializer::JsonWriter& out", true) << ";\n";
+            ss << generateColumnsSignature(classInfo, "readColumns", "serializer::JsonReader& in", false) << ";\n";
+        }
+        if (generateBinary_) {
+            ss << generateColumnsSignature(classInfo, "writeColumns", "serializer::WireWriter& out", true) << ";\n";
+            ss << generateColumnsSignature(classInfo, "readColumns", "serializer::WireReader& in", false) << ";\n";
+        }
+
+        return ss.str();
+    }
+
+    std::string CodeGenerator::generateColumnsSignature(
+        const ClassInfo& classInfo,
+        const std::string& name,
+        const std::string& stream,
+        bool isConst
+    ) const {
+        return inlineSpecifier() + "void " + name + "(" + stream + ", " + (isConst ? "const " : "") +
+               "std::vector<" + classInfo.name + ">& rows)";
+    }
+
+    std::string CodeGenerator::generateSignature(
+        const ClassInfo& classInfo,
+        const std::string& returnType,
+        const std::string& name,
+        const std::string& params,
+        bool isConst
+    ) const {
+        if (!nonIntrusive_) {
+            return inlineSpecifier() + returnType + " " + classInfo.name + "::" + name + "(" + params + ")" +
+                   (isConst ? " const" : "");
+        }
+
+        // Função livre: o objeto vem por último (serializeTo(out, obj))
+        const std::string object = (isConst ? "const " : "") + classInfo.name + "& obj";
+        return inlineSpecifier() + returnType + " " + name + "(" + params + (params.empty() ? "" : ", ") + object + ")";
+    }
+
+    std::string CodeGenerator::generateCall(
+        const std::string& name,
+        const std::string& object,
+        const std::string& args
+    ) const {
+        if (!nonIntrusive_) {
+            return (object.empty() ? "" : object + ".") + name + "(" + args + ")";
+        }
+
+        const std::string target = object.empty() ? "obj" : object;
+        return name + "(" + args + (args.empty() ? "" : ", ") + target + ")";
+    }
+
     std::string CodeGenerator::generateSerializeMethod(
         const ClassInfo& classInfo,
         const TypeChecker& typeChecker
     ) const {
         std::stringstream ss;
 
-        ss << "inline nlohmann::json " << classInfo.name << "::serialize() const {\n";
+        ss << inlineSpecifier() << "nlohmann::json " << classInfo.name << "::serialize() const {\n";
         ss << "    return nlohmann::json{\n";
 
         bool first = true;
@@ -319,7 +886,13 @@ namespace serializer {
                 }
                 else if (analysis.category == TypeChecker::TypeCategory::Container) {
                     // Container de tipos básicos ou serializáveis
-                    ss << "        {\"" << field.name << "\", " << field.name << "}";
+                    ss << "        {\"" << field.name << "\", ";
+                    if (hasSerializableArgs(analysis, typeChecker)) {
+                        ss << generateContainerSerialization(field, typeChecker);
+                    } else {
+                        ss << field.name;
+                    }
+                    ss << "}";
                 }
                 else {
                     // Tipo primitivo ou string
@@ -337,46 +910,75 @@ namespace serializer {
         return ss.str();
     }
 
+    std::string CodeGenerator::generateStreamingSerializeMethods(
+        const ClassInfo& classInfo,
+        const TypeChecker& typeChecker
+    ) const {
+        std::stringstream ss;
+
+        const std::string self = selfPrefix();
+
+        ss << generateSignature(classInfo, "void", "serializeTo", "serializer::JsonWriter& out", true) << " {\n";
+        ss << "    out.beginObject();\n";
+
+        for (const auto& field : classInfo.serializableFields()) {
+            auto analysis = typeChecker.analyzeType(field.type);
+
+            ss << "    out.key(\"" << field.name << "\");\n";
+
+            if (analysis.category == TypeChecker::TypeCategory::Serializable) {
+                // Objeto aninhado escreve com o próprio writer
+                ss << "    " << generateCall("serializeTo", self + field.name, "out") << ";\n";
+            } else {
+                // Primitivos, strings, containers e ponteiros
+                ss << "    out.value(" << self << field.name << ");\n";
+            }
+        }
+
+        ss << "    out.endObject();\n";
+        ss << "}\n\n";
+
+        ss << generateSignature(classInfo, "void", "writeJson", "std::string& out", true) << " {\n";
+        ss << "    out.reserve(out.size() + " << generateCall("serializedJsonSize", "", "") << ");\n";
+        ss << "    serializer::JsonWriter writer(out);\n";
+        ss << "    " << generateCall("serializeTo", "", "writer") << ";\n";
+        ss << "}\n";
+
+        return ss.str();
+    }
+
     std::string CodeGenerator::generateDeserializeMethod(
         const ClassInfo& classInfo,
         const TypeChecker& typeChecker
     ) const {
         std::stringstream ss;
 
-        ss << "inline void " << classInfo.name << "::deserialize(const nlohmann::json& json) {\n";
+        ss << inlineSpecifier() << "void " << classInfo.name << "::deserialize(const nlohmann::json& json) {\n";
 
         for (const auto& field : classInfo.fields) {
             if (field.access == AccessSpecifier::Public && !field.isTransient) {
                 auto analysis = typeChecker.analyzeType(field.type);
 
+                if (analysis.category == TypeChecker::TypeCategory::Container &&
+                    hasSerializableArgs(analysis, typeChecker)) {
+                    // Container de objetos serializáveis - preenchido direto no membro
+                    ss << generateContainerDeserialization(field, "json", typeChecker);
+                    continue;
+                }
+
                 ss << "    " << field.name << " = ";
 
                 if (analysis.category == TypeChecker::TypeCategory::Serializable) {
                     // Desserializa objeto aninhado
-                    ss << field.type << "::fromJson(json[\"" << field.name << "\"])";
+                    ss << field.type << "::fromJson(json.at(\"" << field.name << "\"))";
                 }
                 else if (analysis.category == TypeChecker::TypeCategory::Container) {
-                    // Container - verifica se contém tipos serializáveis
-                    bool hasSerializableArgs = false;
-                    for (const auto& arg : analysis.templateArgs) {
-                        auto argAnalysis = typeChecker.analyzeType(arg);
-                        if (argAnalysis.category == TypeChecker::TypeCategory::Serializable) {
-                            hasSerializableArgs = true;
-                            break;
-                        }
-                    }
-
-                    if (hasSerializableArgs) {
-                        // Container de objetos serializáveis - precisa de desserialização customizada
-                        ss << generateContainerDeserialization(field, "json", typeChecker);
-                    } else {
-                        // Container de tipos básicos
-                        ss << "json[\"" << field.name << "\"].get<" << field.type << ">()";
-                    }
+                    // Container de tipos básicos
+                    ss << "json.at(\"" << field.name << "\").get<" << field.type << ">()";
                 }
                 else {
                     // Tipo básico
-                    ss << "json[\"" << field.name << "\"]";
+                    ss << "json.at(\"" << field.name << "\")";
 
                     if (needsJsonGet(field.type)) {
                         ss << ".get<" << field.type << ">()";
@@ -392,61 +994,286 @@ namespace serializer {
         return ss.str();
     }
 
-    std::string CodeGenerator::generateContainerDeserialization(
-        const FieldInfo& field,
-        const std::string& jsonVar,
+    std::string CodeGenerator::generateDeserializeIntoMethod(
+        const ClassInfo& classInfo,
         const TypeChecker& typeChecker
     ) const {
-        auto [base, templateArgs] = Utils::extractTemplateInfo(field.type);
+        std::stringstream ss;
+
+        ss << inlineSpecifier() << "void " << classInfo.name << "::deserializeInto(const nlohmann::json& json) {\n";
+
+        for (const auto& field : classInfo.serializableFields()) {
+            auto analysis = typeChecker.analyzeType(field.type);
+            if (analysis.category == TypeChecker::TypeCategory::Serializable) {
+                ss << "    " << field.name << ".deserializeInto(json.at(\"" << field.name << "\"));\n";
+            } else {
+                ss << "    serializer::assignFromJson(" << field.name << ", json.at(\"" << field.name << "\"));\n";
+            }
+        }
+
+        ss << "}\n";
+
+        return ss.str();
+    }
+
+    std::string CodeGenerator::generateStreamingDeserializeMethods(
+        const ClassInfo& classInfo,
+        const TypeChecker& typeChecker
+    ) const {
+        std::stringstream ss;
+
+        const std::string self = selfPrefix();
+
+        // Um bit por campo: campo ausente lança, como o json.at() do deserialize
+        std::vector<std::string> fields;
+        std::unordered_map<std::string, size_t> fieldIndex;
+        for (const auto& field : classInfo.serializableFields()) {
+            fieldIndex.emplace(field.name, fields.size());
+            fields.push_back(field.name);
+        }
+
+        ss << generateSignature(classInfo, "void", "readJson", "serializer::JsonReader& in", false) << " {\n";
+        if (!fields.empty()) {
+            ss << "    uint64_t seen[" << (fields.size() + 63) / 64 << "] = {};\n";
+        }
+        ss << "    in.beginObject();\n";
+        ss << "    std::string_view key;\n";
+        ss << "    while (in.nextKey(key)) {\n";
+
+        // Cada chave é despachada assim que é tokenizada, escrevendo direto no membro
+        ss << generateKeyDispatch(
+            classInfo,
+            [this, &typeChecker, &self, &fieldIndex](const FieldInfo& field) {
+                const size_t i = fieldIndex.at(field.name);
+                const std::string mark = " seen[" + std::to_string(i / 64) + "] |= uint64_t{1} << " +
+                                         std::to_string(i % 64) + ";";
+                auto analysis = typeChecker.analyzeType(field.type);
+                if (analysis.category == TypeChecker::TypeCategory::Serializable) {
+                    return generateCall("readJson", self + field.name, "in") + ";" + mark;
+                }
+                // Containers (inclusive de serializáveis) recursam via JsonReader::read
+                return "in.read(" + self + field.name + ");" + mark;
+            },
+            2
+        );
+        ss << "        in.skipValue();\n";
+        ss << "    }\n";
+        if (!fields.empty()) {
+            ss << "    in.requireFields(seen, {";
+            for (size_t i = 0; i < fields.size(); ++i) {
+                ss << (i > 0 ? ", " : "") << "\"" << fields[i] << "\"";
+            }
+            ss << "});\n";
+        }
+        ss << "}\n\n";
+
+        ss << generateSignature(classInfo, "void", "deserializeFrom", "std::string_view json", false) << " {\n";
+        ss << "    serializer::JsonReader in(json);\n";
+        ss << "    " << generateCall("readJson", "", "in") << ";\n";
+        ss << "    in.finish();\n";
+        ss << "}\n";
+
+        return ss.str();
+    }
+
+    std::string CodeGenerator::generateKeyDispatch(
+        const ClassInfo& classInfo,
+        const std::function<std::string(const FieldInfo&)>& readStatement,
+        int indentLevel
+    ) const {
+        if (classInfo.getSerializableFieldCount() == 0) {
+            return "";
+        }
 
         std::stringstream ss;
+        auto indent = [this, indentLevel](int extra) {
+            return makeIndent(indentLevel + extra, indentSize_);
+        };
+
+        auto emitMatch = [&](const FieldInfo& field, int extra) {
+            ss << indent(extra) << "if (key == \"" << field.name << "\") {\n";
+            ss << indent(extra + 1) << readStatement(field) << "\n";
+            ss << indent(extra + 1) << "continue;\n";
+            ss << indent(extra) << "}\n";
+        };
+
+        // Agrupa por tamanho (ordenado para saída determinística)
+        std::map<size_t, std::vector<const FieldInfo*>> byLength;
+        for (const auto& field : classInfo.serializableFields()) {
+            byLength[field.name.size()].push_back(&field);
+        }
 
-        if (base == "std::vector" || base == "std::list" || base == "std::deque") {
-            // Vector/list/deque de objetos serializáveis
-            std::string elementType = templateArgs[0];
-            auto elementAnalysis = typeChecker.analyzeType(elementType);
+        ss << indent(0) << "switch (key.size()) {\n";
 
-            ss << "[]() -> " << field.type << " {\n";
-            ss << "    " << field.type << " result;\n";
-            ss << "    const auto& jsonArray = " << jsonVar << "[\"" << field.name << "\"];\n";
-            ss << "    for (const auto& item : jsonArray) {\n";
+        for (const auto& [length, group] : byLength) {
+            ss << indent(1) << "case " << length << ":\n";
 
-            if (elementAnalysis.category == TypeChecker::TypeCategory::Serializable) {
-                ss << "        result.push_back(" << elementType << "::fromJson(item));\n";
+            if (group.size() == 1) {
+                emitMatch(*group.front(), 2);
             } else {
-                ss << "        result.push_back(item.get<" << elementType << ">());\n";
+                // Posição com mais caracteres distintos; se todos diferem ali, o hash é perfeito
+                size_t bestPos = 0;
+                size_t bestDistinct = 0;
+                for (size_t pos = 0; pos < length; pos++) {
+                    std::set<char> distinct;
+                    for (const auto* field : group) {
+                        distinct.insert(field->name[pos]);
+                    }
+                    if (distinct.size() > bestDistinct) {
+                        bestDistinct = distinct.size();
+                        bestPos = pos;
+                    }
+                }
+
+                std::map<char, std::vector<const FieldInfo*>> buckets;
+                for (const auto* field : group) {
+                    buckets[field->name[bestPos]].push_back(field);
+                }
+
+                ss << indent(2) << "switch (key[" << bestPos << "]) {\n";
+                for (const auto& [c, bucket] : buckets) {
+                    ss << indent(3) << "case '" << c << "':\n";
+                    for (const auto* field : bucket) {
+                        emitMatch(*field, 4);
+                    }
+                    ss << indent(4) << "break;\n";
+                }
+                ss << indent(2) << "}\n";
             }
 
-            ss << "    }\n";
-            ss << "    return result;\n";
-            ss << "}()";
-
-        } else if (base == "std::map" || base == "std::unordered_map") {
-            // Map com objetos serializáveis como valor
-            std::string keyType = templateArgs[0];
-            std::string valueType = templateArgs[1];
-            auto valueAnalysis = typeChecker.analyzeType(valueType);
-
-            ss << "[]() -> " << field.type << " {\n";
-            ss << "    " << field.type << " result;\n";
-            ss << "    const auto& jsonObject = " << jsonVar << "[\"" << field.name << "\"];\n";
-            ss << "    for (auto it = jsonObject.begin(); it != jsonObject.end(); ++it) {\n";
-            ss << "        " << keyType << " key = it.key();\n";
-
-            if (valueAnalysis.category == TypeChecker::TypeCategory::Serializable) {
-                ss << "        " << valueType << " value = " << valueType << "::fromJson(it.value());\n";
+            ss << indent(2) << "break;\n";
+        }
+
+        ss << indent(0) << "}\n";
+
+        return ss.str();
+    }
+
+    bool CodeGenerator::hasSerializableArgs(
+        const TypeChecker::TypeAnalysis& analysis,
+        const TypeChecker& typeChecker
+    ) const {
+        for (const auto& arg : analysis.templateArgs) {
+            auto argAnalysis = typeChecker.analyzeType(arg);
+            if (argAnalysis.category == TypeChecker::TypeCategory::Serializable) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::string CodeGenerator::generateContainerSerialization(
+        const FieldInfo& field,
+        const TypeChecker& typeChecker
+    ) const {
+        auto [base, templateArgs] = Utils::extractTemplateInfo(field.type);
+
+        std::stringstream ss;
+
+        if (isSequenceContainer(base) &&
+            typeChecker.analyzeType(templateArgs[0]).category == TypeChecker::TypeCategory::Serializable) {
+            ss << "[this]() {\n";
+            ss << "            nlohmann::json array = nlohmann::json::array();\n";
+            ss << "            for (const auto& item : " << field.name << ") {\n";
+            ss << "                array.push_back(item.serialize());\n";
+            ss << "            }\n";
+            ss << "            return array;\n";
+            ss << "        }()";
+        } else if (isMapContainer(base) &&
+                   typeChecker.analyzeType(templateArgs[1]).category == TypeChecker::TypeCategory::Serializable) {
+            // Mesmo formato do nlohmann: chaves string viram objeto, demais viram array de pares
+            const bool stringKey =
+                typeChecker.analyzeType(templateArgs[0]).category == TypeChecker::TypeCategory::String;
+            ss << "[this]() {\n";
+            ss << "            nlohmann::json entries = nlohmann::json::" << (stringKey ? "object" : "array") << "();\n";
+            ss << "            for (const auto& [key, item] : " << field.name << ") {\n";
+            if (stringKey) {
+                ss << "                entries.emplace(key, item.serialize());\n";
             } else {
-                ss << "        " << valueType << " value = it.value().get<" << valueType << ">();\n";
+                ss << "                entries.push_back(nlohmann::json::array({key, item.serialize()}));\n";
+            }
+            ss << "            }\n";
+            ss << "            return entries;\n";
+            ss << "        }()";
+        } else {
+            // Demais formas ficam com o adl_serializer do nlohmann
+            ss << field.name;
+        }
+
+        return ss.str();
+    }
+
+    std::string CodeGenerator::generateContainerDeserialization(
+        const FieldInfo& field,
+        const std::string& jsonVar,
+        const TypeChecker& typeChecker
+    ) const {
+        auto [base, templateArgs] = Utils::extractTemplateInfo(field.type);
+        const std::string& member = field.name;
+        const bool pmr = generatePmr_ && base.rfind("std::pmr::", 0) == 0;
+
+        std::stringstream ss;
+
+        if (isSequenceContainer(base) &&
+            typeChecker.analyzeType(templateArgs[0]).category == TypeChecker::TypeCategory::Serializable) {
+            // Reaproveita o armazenamento do membro e constrói cada elemento no lugar
+            ss << "    {\n";
+            ss << "        const auto& jsonArray = " << jsonVar << ".at(\"" << field.name << "\");\n";
+            ss << "        " << member << ".clear();\n";
+            if (base == "std::vector" || base == "std::pmr::vector") {
+                ss << "        " << member << ".reserve(jsonArray.size());\n";
             }
+            ss << "        for (const auto& item : jsonArray) {\n";
+            ss << "            auto& element = " << member << ".emplace_back();\n";
+            if (pmr) {
+                ss << "            element.useMemoryResource(" << member << ".get_allocator().resource());\n";
+            }
+            ss << "            element.deserialize(item);\n";
+            ss << "        }\n";
+            ss << "    }\n";
 
-            ss << "        result[key] = value;\n";
+        } else if (isMapContainer(base) &&
+                   typeChecker.analyzeType(templateArgs[1]).category == TypeChecker::TypeCategory::Serializable) {
+            const std::string& keyType = templateArgs[0];
+            const bool stringKey =
+                typeChecker.analyzeType(keyType).category == TypeChecker::TypeCategory::String;
+            const bool unordered = base.find("unordered_") != std::string::npos;
+
+            ss << "    {\n";
+            ss << "        const auto& jsonEntries = " << jsonVar << ".at(\"" << field.name << "\");\n";
+            ss << "        " << member << ".clear();\n";
+            if (unordered) {
+                ss << "        " << member << ".reserve(jsonEntries.size());\n";
+            }
+            if (stringKey) {
+                // Objetos do nlohmann já vêm com as chaves ordenadas: o hint no fim é O(1) no std::map
+                ss << "        for (auto it = jsonEntries.begin(); it != jsonEntries.end(); ++it) {\n";
+                ss << "            auto entry = " << member << ".emplace_hint(" << member
+                   << ".end(), std::piecewise_construct,\n";
+                ss << "                std::forward_as_tuple(it.key()), std::forward_as_tuple());\n";
+                if (pmr) {
+                    ss << "            entry->second.useMemoryResource(" << member << ".get_allocator().resource());\n";
+                }
+                ss << "            entry->second.deserialize(it.value());\n";
+            } else {
+                // Chaves não-string chegam como array de pares [chave, valor]
+                ss << "        for (const auto& pair : jsonEntries) {\n";
+                ss << "            auto entry = " << member << ".emplace_hint(" << member
+                   << ".end(), std::piecewise_construct,\n";
+                ss << "                std::forward_as_tuple(pair.at(0).get<" << keyType
+                   << ">()), std::forward_as_tuple());\n";
+                if (pmr) {
+                    ss << "            entry->second.useMemoryResource(" << member << ".get_allocator().resource());\n";
+                }
+                ss << "            entry->second.deserialize(pair.at(1));\n";
+            }
+            ss << "        }\n";
             ss << "    }\n";
-            ss << "    return result;\n";
-            ss << "}()";
 
         } else {
             // Outros containers - fallback para get<>
-            ss << jsonVar << "[\"" << field.name << "\"].get<" << field.type << ">()";
+            ss << "    " << member << " = " << jsonVar << ".at(\"" << field.name << "\").get<"
+               << field.type << ">();\n";
         }
 
         return ss.str();
@@ -458,7 +1285,7 @@ namespace serializer {
     ) const {
         std::stringstream ss;
 
-        ss << "inline " << classInfo.name << " " << classInfo.name
+        ss << inlineSpecifier() << classInfo.name << " " << classInfo.name
            << "::fromJson(const nlohmann::json& json) {\n";
         ss << "    " << classInfo.name << " obj;\n";
         ss << "    obj.deserialize(json);\n";
@@ -468,6 +1295,247 @@ namespace serializer {
         return ss.str();
     }
 
+    std::string CodeGenerator::generateBinaryMethods(
+        const ClassInfo& classInfo,
+        const TypeChecker& typeChecker
+    ) const {
+        std::stringstream ss;
+        const std::string self = selfPrefix();
+        const std::string address = nonIntrusive_ ? "&obj" : "this";
+
+        if (isFlatPrimitiveClass(classInfo, typeChecker)) {
+            // Só primitivos: layout fixo little-endian, copiado em bloco quando a memória já bate
+            auto fields = classInfo.serializableFields();
+            std::string fieldBytes;
+            bool hasBool = false;
+            for (const auto& field : fields) {
+                if (!fieldBytes.empty()) fieldBytes += " + ";
+                fieldBytes += "sizeof(" + self + field.name + ")";
+                if (typeChecker.analyzeType(field.type).baseType == "bool") {
+                    hasBool = true;
+                }
+            }
+
+            ss << generateSignature(classInfo, "void", "writeBinary", "serializer::WireWriter& out", true) << " {\n";
+            ss << "    if constexpr (serializer::isWireRawCopyable<" << classInfo.name
+               << ">(" << fieldBytes << ")) {\n";
+            ss << "        out.bytes(" << address << ", sizeof(" << classInfo.name << "));\n";
+            ss << "    } else {\n";
+            for (const auto& field : fields) {
+                ss << "        out.fixedValue(" << self << field.name << ");\n";
+            }
+            ss << "    }\n";
+            ss << "}\n\n";
+
+            ss << generateSignature(classInfo, "void", "readBinary", "serializer::WireReader& in", false) << " {\n";
+            if (hasBool) {
+                // Bytes arbitrários não podem virar bool por memcpy: lê campo a campo
+                for (const auto& field : fields) {
+                    ss << "    in.readFixed(" << self << field.name << ");\n";
+                }
+            } else {
+                ss << "    if constexpr (serializer::isWireRawCopyable<" << classInfo.name
+                   << ">(" << fieldBytes << ")) {\n";
+                ss << "        in.copyTo(" << address << ", sizeof(" << classInfo.name << "));\n";
+                ss << "    } else {\n";
+                for (const auto& field : fields) {
+                    ss << "        in.readFixed(" << self << field.name << ");\n";
+                }
+                ss << "    }\n";
+            }
+            ss << "}\n\n";
+        } else {
+            ss << generateFieldwiseBinaryMethods(classInfo, typeChecker);
+        }
+
+        ss << generateSignature(classInfo, "void", "serializeBinary", "std::string& out", true) << " {\n";
+        ss << "    out.reserve(out.size() + " << generateCall("serializedSize", "", "") << ");\n";
+        ss << "    serializer::WireWriter writer(out);\n";
+        ss << "    " << generateCall("writeBinary", "", "writer") << ";\n";
+        ss << "}\n\n";
+
+        ss << generateSignature(classInfo, "void", "deserializeBinary", "std::string_view data", false) << " {\n";
+        ss << "    serializer::WireReader in(data);\n";
+        ss << "    " << generateCall("readBinary", "", "in") << ";\n";
+        ss << "    in.finish();\n";
+        ss << "}\n";
+
+        return ss.str();
+    }
+
+    std::string CodeGenerator::generateFieldwiseBinaryMethods(
+        const ClassInfo& classInfo,
+        const TypeChecker& typeChecker
+    ) const {
+        std::stringstream ss;
+        const std::string self = selfPrefix();
+
+        // Campos bool vão empacotados em bits no início da mensagem
+        std::vector<FieldInfo> boolFields;
+        std::vector<FieldInfo> otherFields;
+        for (const auto& field : classInfo.serializableFields()) {
+            auto analysis = typeChecker.analyzeType(field.type);
+            if (analysis.category == TypeChecker::TypeCategory::Primitive &&
+                analysis.baseType == "bool") {
+                boolFields.push_back(field);
+            } else {
+                otherFields.push_back(field);
+            }
+        }
+
+        // writeBinary
+        ss << generateSignature(classInfo, "void", "writeBinary", "serializer::WireWriter& out", true) << " {\n";
+
+        for (size_t group = 0; group < boolFields.size(); group += 8) {
+            ss << "    out.byte(static_cast<std::uint8_t>(";
+            for (size_t i = group; i < std::min(group + 8, boolFields.size()); i++) {
+                if (i != group) ss << " |\n        ";
+                ss << "(" << self << boolFields[i].name << " ? 0x"
+                   << std::hex << (1u << (i - group)) << std::dec << "u : 0u)";
+            }
+            ss << "));\n";
+        }
+
+        for (const auto& field : otherFields) {
+            auto analysis = typeChecker.analyzeType(field.type);
+            if (analysis.category == TypeChecker::TypeCategory::Serializable) {
+                ss << "    " << generateCall("writeBinary", self + field.name, "out") << ";\n";
+            } else {
+                ss << "    out.value(" << self << field.name << ");\n";
+            }
+        }
+
+        ss << "}\n\n";
+
+        // readBinary
+        ss << generateSignature(classInfo, "void", "readBinary", "serializer::WireReader& in", false) << " {\n";
+
+        for (size_t group = 0; group < boolFields.size(); group += 8) {
+            ss << "    {\n";
+            ss << "        const std::uint8_t bits = in.byte();\n";
+            for (size_t i = group; i < std::min(group + 8, boolFields.size()); i++) {
+                ss << "        " << self << boolFields[i].name << " = (bits & 0x"
+                   << std::hex << (1u << (i - group)) << std::dec << "u) != 0;\n";
+            }
+            ss << "    }\n";
+        }
+
+        for (const auto& field : otherFields) {
+            auto analysis = typeChecker.analyzeType(field.type);
+            if (analysis.category == TypeChecker::TypeCategory::Serializable) {
+                ss << "    " << generateCall("readBinary", self + field.name, "in") << ";\n";
+            } else {
+                ss << "    in.read(" << self << field.name << ");\n";
+            }
+        }
+
+        ss << "}\n\n";
+
+        return ss.str();
+    }
+
+    bool CodeGenerator::isFlatPrimitiveClass(
+        const ClassInfo& classInfo,
+        const TypeChecker& typeChecker
+    ) const {
+        // Todos os campos precisam ser serializados (senão o memcpy levaria campos a mais)
+        if (classInfo.fields.empty() || !classInfo.baseClasses.empty()) {
+            return false;
+        }
+
+        return std::all_of(classInfo.fields.begin(), classInfo.fields.end(),
+            [&typeChecker](const FieldInfo& field) {
+                if (field.access != AccessSpecifier::Public || field.isTransient) {
+                    return false;
+                }
+                auto analysis = typeChecker.analyzeType(field.type);
+                return analysis.category == TypeChecker::TypeCategory::Primitive &&
+                       analysis.baseType != "long double";
+            });
+    }
+
+    std::string CodeGenerator::generateSizeMethods(
+        const ClassInfo& classInfo,
+        const TypeChecker& typeChecker
+    ) const {
+        std::stringstream ss;
+        const std::string self = selfPrefix();
+        auto fields = classInfo.serializableFields();
+        const size_t fieldCount = classInfo.getSerializableFieldCount();
+
+        if (generateBinary_ && isFlatPrimitiveClass(classInfo, typeChecker)) {
+            // Layout fixo: cada campo ocupa sizeof(campo)
+            ss << generateSignature(classInfo, "std::size_t", "serializedSize", "", true) << " {\n";
+            ss << "    return ";
+            bool first = true;
+            for (const auto& field : fields) {
+                if (!first) ss << " + ";
+                ss << "sizeof(" << self << field.name << ")";
+                first = false;
+            }
+            ss << ";\n";
+            ss << "}\n\n";
+        } else if (generateBinary_) {
+            // Mesma ordem e agrupamento de generateFieldwiseBinaryMethods
+            size_t boolCount = 0;
+            for (const auto& field : fields) {
+                auto analysis = typeChecker.analyzeType(field.type);
+                if (analysis.category == TypeChecker::TypeCategory::Primitive &&
+                    analysis.baseType == "bool") {
+                    boolCount++;
+                }
+            }
+
+            ss << generateSignature(classInfo, "std::size_t", "serializedSize", "", true) << " {\n";
+            ss << "    std::size_t size = " << (boolCount + 7) / 8 << ";";
+            if (boolCount > 0) ss << " // " << boolCount << " campo(s) bool empacotado(s)";
+            ss << "\n";
+
+            for (const auto& field : fields) {
+                auto analysis = typeChecker.analyzeType(field.type);
+                if (analysis.category == TypeChecker::TypeCategory::Primitive &&
+                    analysis.baseType == "bool") {
+                    continue;
+                }
+
+                if (analysis.category == TypeChecker::TypeCategory::Serializable) {
+                    ss << "    size += " << generateCall("serializedSize", self + field.name, "") << ";\n";
+                } else {
+                    ss << "    size += serializer::WireWriter::sizeOf(" << self << field.name << ");\n";
+                }
+            }
+
+            ss << "    return size;\n";
+            ss << "}\n\n";
+        }
+
+        // Parte fixa do JSON (chaves, aspas, dois-pontos, vírgulas) é calculada aqui
+        size_t fixedJsonSize = 2;
+        for (const auto& field : fields) {
+            fixedJsonSize += field.name.size() + 3;
+        }
+        if (fieldCount > 0) {
+            fixedJsonSize += fieldCount - 1;
+        }
+
+        ss << generateSignature(classInfo, "std::size_t", "serializedJsonSize", "", true) << " {\n";
+        ss << "    std::size_t size = " << fixedJsonSize << "; // chaves e separadores\n";
+
+        for (const auto& field : fields) {
+            auto analysis = typeChecker.analyzeType(field.type);
+            if (analysis.category == TypeChecker::TypeCategory::Serializable) {
+                ss << "    size += " << generateCall("serializedJsonSize", self + field.name, "") << ";\n";
+            } else {
+                ss << "    size += serializer::JsonWriter::sizeBound(" << self << field.name << ");\n";
+            }
+        }
+
+        ss << "    return size;\n";
+        ss << "}\n";
+
+        return ss.str();
+    }
+
     std::string CodeGenerator::generateGenericMethods(
         const ClassInfo& classInfo
     ) const {
@@ -475,18 +1543,18 @@ namespace serializer {
 
         ss << "// Serialização genérica (compatível com Boost)\n";
         ss << "template<typename Archive>\n";
-        ss << "inline void " << classInfo.name << "::serialize(Archive& ar) const {\n";
+        ss << inlineSpecifier() << "void " << classInfo.name << "::serialize(Archive& ar) const {\n";
 
-        for (const auto& field : classInfo.getSerializableFields()) {
+        for (const auto& field : classInfo.serializableFields()) {
             ss << "    ar & " << field.name << ";\n";
         }
 
         ss << "}\n\n";
 
         ss << "template<typename Archive>\n";
-        ss << "inline void " << classInfo.name << "::deserialize(Archive& ar) {\n";
+        ss << inlineSpecifier() << "void " << classInfo.name << "::deserialize(Archive& ar) {\n";
 
-        for (const auto& field : classInfo.getSerializableFields()) {
+        for (const auto& field : classInfo.serializableFields()) {
             ss << "    ar & " << field.name << ";\n";
         }
 
@@ -495,13 +1563,66 @@ namespace serializer {
         return ss.str();
     }
 
+    std::string CodeGenerator::generatePmrMethods(
+        const ClassInfo& classInfo,
+        const TypeChecker& typeChecker
+    ) const {
+        std::stringstream ss;
+
+        ss << inlineSpecifier() << "void " << classInfo.name
+           << "::useMemoryResource(std::pmr::memory_resource* resource) {\n";
+        for (const auto& field : classInfo.serializableFields()) {
+            auto analysis = typeChecker.analyzeType(field.type);
+            if (analysis.category == TypeChecker::TypeCategory::Serializable) {
+                ss << "    " << field.name << ".useMemoryResource(resource);\n";
+            } else if (field.type.rfind("std::pmr::", 0) == 0) {
+                // Alocador polimórfico não se propaga na atribuição: recria o campo já no resource
+                ss << "    if (" << field.name << ".get_allocator().resource() != resource) {\n";
+                ss << "        std::destroy_at(&" << field.name << ");\n";
+                ss << "        std::construct_at(&" << field.name << ", resource);\n";
+                ss << "    }\n";
+            }
+        }
+        ss << "}\n\n";
+
+        ss << inlineSpecifier() << "void " << classInfo.name
+           << "::deserialize(const nlohmann::json& json, std::pmr::memory_resource* resource) {\n";
+        ss << "    useMemoryResource(resource);\n";
+        ss << "    deserialize(json);\n";
+        ss << "}\n\n";
+
+        ss << inlineSpecifier() << "void " << classInfo.name
+           << "::deserializeFrom(std::string_view json, std::pmr::memory_resource* resource) {\n";
+        ss << "    useMemoryResource(resource);\n";
+        ss << "    serializer::JsonReader in(json, resource);\n";
+        ss << "    readJson(in);\n";
+        ss << "    in.finish();\n";
+        ss << "}\n";
+
+        if (generateBinary_) {
+            ss << "\n";
+            ss << inlineSpecifier() << "void " << classInfo.name
+               << "::deserializeBinary(std::string_view data, std::pmr::memory_resource* resource) {\n";
+            ss << "    useMemoryResource(resource);\n";
+            ss << "    serializer::WireReader in(data, resource);\n";
+            ss << "    readBinary(in);\n";
+            ss << "    in.finish();\n";
+            ss << "}\n";
+        }
+
+        return ss.str();
+    }
+
     bool CodeGenerator::needsJsonGet(const std::string& type) const {
         // Tipos que precisam de .get<T>() no nlohmann/json
         static const std::set<std::string> needsGetTypes = {
             "std::vector", "std::list", "std::deque", "std::array",
             "std::set", "std::unordered_set", "std::multiset",
             "std::map", "std::unordered_map", "std::multimap",
-            "std::pair", "std::tuple", "std::optional", "std::variant"
+            "std::pair", "std::tuple", "std::optional", "std::variant",
+            "std::pmr::string", "std::pmr::vector", "std::pmr::list", "std::pmr::deque",
+            "std::pmr::set", "std::pmr::unordered_set", "std::pmr::multiset",
+            "std::pmr::map", "std::pmr::unordered_map", "std::pmr::multimap"
         };
 
         std::string lowerType = toLower(type);
@@ -5,8 +5,12 @@
 #include <array>
 #include <cctype>
 #include <iostream>
+#include <set>
 
 #include "include/FileWalker.h"
+#include "include/IgnoreRules.h"
+#include "include/JsonReader.h"
+#include "include/SourceFile.h"
 
 namespace fs = std::filesystem;
 
@@ -30,6 +34,18 @@ namespace serializer {
             "build", "cmake-build-", "__pycache__"
         };
 
+        bool hasHeaderExtension(const fs::path& path) {
+            const std::string ext = toLower(path.extension().string());
+
+            for (const auto& headerExt : HEADER_EXTENSIONS) {
+                if (ext == headerExt) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
         // Verifica se um diretório deve ser ignorado
         bool shouldSkipDirectory(const fs::path& dirPath) {
             std::string dirName = toLower(dirPath.filename().string());
@@ -55,9 +71,245 @@ namespace serializer {
 
             return false;
         }
+
+        // Estado compartilhado entre as caminhadas de uma busca
+        struct WalkState {
+            fs::path root;                      // Raiz do projeto, na forma passada pelo usuário
+            IgnoreRules rules;
+            bool useGitignore = true;
+            std::set<fs::path> loadedGitignores;
+            size_t filesChecked = 0;
+            size_t directoriesSkipped = 0;
+        };
+
+        // Caminho relativo à raiz com "/" como separador
+        std::string relativePath(const fs::path& path, const WalkState& state) {
+            return path.lexically_relative(state.root).generic_string();
+        }
+
+        bool isInside(const fs::path& path, const fs::path& root) {
+            const fs::path relative = path.lexically_relative(root);
+            return !relative.empty() && *relative.begin() != "..";
+        }
+
+        void loadGitignore(const fs::path& dir, const std::string& base, WalkState& state) {
+            if (state.useGitignore && state.loadedGitignores.insert(dir).second) {
+                state.rules.loadFile(dir / ".gitignore", base);
+            }
+        }
+
+        // Diretório podado pela lista fixa ou pelas regras de exclusão
+        bool isPruned(const fs::path& dir, const std::string& relative, const WalkState& state) {
+            return shouldSkipDirectory(dir) || (!state.rules.empty() && state.rules.isIgnored(relative, true));
+        }
+
+        /**
+         * Percorre start coletando headers; diretórios ignorados são podados com
+         * disable_recursion_pending(), então nada abaixo deles é listado
+         * @param recursive false = só os arquivos do próprio diretório
+         * @param directories Recebe os diretórios percorridos (opcional)
+         */
+        void walk(const fs::path& start, bool recursive, WalkState& state, std::vector<fs::path>& headers,
+                  std::vector<fs::path>* directories = nullptr) {
+            fs::recursive_directory_iterator it(start, fs::directory_options::skip_permission_denied);
+            for (const fs::recursive_directory_iterator end; it != end; ++it) {
+                const auto& entry = *it;
+                state.filesChecked++;
+
+                if (entry.is_directory()) {
+                    const std::string relative = relativePath(entry.path(), state);
+                    if (!recursive || isPruned(entry.path(), relative, state)) {
+                        it.disable_recursion_pending();
+                        state.directoriesSkipped++;
+                        continue;
+                    }
+                    // .gitignore aninhado vale para o próprio diretório e abaixo
+                    loadGitignore(entry.path(), relative + "/", state);
+                    if (directories) directories->push_back(entry.path());
+                    continue;
+                }
+
+                if (entry.is_regular_file() && hasHeaderExtension(entry.path()) &&
+                    (state.rules.empty() || !state.rules.isIgnored(relativePath(entry.path(), state), false))) {
+                    headers.push_back(entry.path());
+                }
+            }
+        }
+
+        /**
+         * Prepara a caminhada de um diretório interno ao projeto: carrega os
+         * .gitignore da raiz até ele e confere se algum ancestral está podado
+         * @return false se dir (ou um ancestral) deve ser ignorado
+         */
+        bool enterDirectory(const fs::path& dir, WalkState& state) {
+            fs::path current = state.root;
+            std::string relative;
+            loadGitignore(current, "", state);
+
+            for (const auto& part : dir.lexically_relative(state.root)) {
+                if (part == ".") continue;
+                current /= part;
+                relative += relative.empty() ? part.generic_string() : "/" + part.generic_string();
+                if (isPruned(current, relative, state)) {
+                    return false;
+                }
+                loadGitignore(current, relative + "/", state);
+            }
+            return true;
+        }
+
+        // Quebra uma linha de comando respeitando aspas e barra invertida
+        std::vector<std::string> splitCommand(std::string_view command) {
+            std::vector<std::string> args;
+            std::string current;
+            bool hasArg = false;
+            char quote = 0;
+
+            for (size_t i = 0; i < command.size(); ++i) {
+                const char c = command[i];
+                if (quote != 0) {
+                    if (c == quote) {
+                        quote = 0;
+                    } else if (c == '\\' && quote == '"' && i + 1 < command.size()) {
+                        current += command[++i];
+                    } else {
+                        current += c;
+                    }
+                } else if (c == '"' || c == '\'') {
+                    quote = c;
+                    hasArg = true;
+                } else if (c == '\\' && i + 1 < command.size()) {
+                    current += command[++i];
+                    hasArg = true;
+                } else if (std::isspace(static_cast<unsigned char>(c))) {
+                    if (hasArg) args.push_back(std::move(current));
+                    current.clear();
+                    hasArg = false;
+                } else {
+                    current += c;
+                    hasArg = true;
+                }
+            }
+            if (hasArg) args.push_back(std::move(current));
+            return args;
+        }
+
+        // Diretórios de include (-I, -iquote, /I) de uma entrada do compile_commands.json
+        void collectIncludeDirectories(const std::vector<std::string>& args, const fs::path& directory,
+                                       std::vector<fs::path>& includeDirs) {
+            for (size_t i = 0; i < args.size(); ++i) {
+                std::string_view arg = args[i];
+                std::string_view value;
+
+                for (const std::string_view flag : {"-iquote", "-I", "/I"}) {
+                    if (!arg.starts_with(flag)) continue;
+                    if (arg.size() > flag.size()) {
+                        value = arg.substr(flag.size());
+                    } else if (i + 1 < args.size()) {
+                        value = args[++i];
+                    }
+                    break;
+                }
+
+                if (!value.empty()) {
+                    includeDirs.push_back((directory / fs::path(value)).lexically_normal());
+                }
+            }
+        }
+
+        /**
+         * Lê o compile_commands.json: headers listados, diretórios das unidades
+         * de tradução e diretórios de include
+         * @return false se o arquivo não pôde ser lido ou é inválido
+         */
+        bool readCompileCommands(const fs::path& file, std::vector<fs::path>& listedFiles,
+                                 std::vector<fs::path>& sourceDirs, std::vector<fs::path>& includeDirs) {
+            const auto source = SourceFile::open(file);
+            if (!source) {
+                std::cerr << "Erro: não foi possível ler " << file << "\n";
+                return false;
+            }
+
+            try {
+                JsonReader reader(source->content());
+                reader.beginArray();
+                while (reader.nextElement()) {
+                    std::string directory;
+                    std::string entryFile;
+                    std::string command;
+                    std::vector<std::string> arguments;
+
+                    reader.beginObject();
+                    std::string_view key;
+                    while (reader.nextKey(key)) {
+                        if (key == "directory") {
+                            directory = reader.readString();
+                        } else if (key == "file") {
+                            entryFile = reader.readString();
+                        } else if (key == "command") {
+                            command = reader.readString();
+                        } else if (key == "arguments") {
+                            reader.read(arguments);
+                        } else {
+                            reader.skipValue();
+                        }
+                    }
+
+                    if (arguments.empty() && !command.empty()) {
+                        arguments = splitCommand(command);
+                    }
+
+                    const fs::path base = fs::absolute(directory.empty() ? file.parent_path() : fs::path(directory));
+                    if (!entryFile.empty()) {
+                        const fs::path path = (base / fs::path(entryFile)).lexically_normal();
+                        listedFiles.push_back(path);
+                        sourceDirs.push_back(path.parent_path());
+                    }
+                    collectIncludeDirectories(arguments, base, includeDirs);
+                }
+                reader.finish();
+            } catch (const JsonParseError& e) {
+                std::cerr << "Erro: " << file << " inválido: " << e.what() << "\n";
+                return false;
+            }
+
+            return true;
+        }
+
+        // Remove duplicados e diretórios contidos em outro da lista
+        void keepOutermost(std::vector<fs::path>& dirs) {
+            std::ranges::sort(dirs);
+            dirs.erase(std::ranges::unique(dirs).begin(), dirs.end());
+
+            std::vector<fs::path> outermost;
+            for (auto& dir : dirs) {
+                if (outermost.empty() || !isInside(dir, outermost.back())) {
+                    outermost.push_back(std::move(dir));
+                }
+            }
+            dirs = std::move(outermost);
+        }
+
+        WalkState makeState(const fs::path& projectPath, const WalkOptions& options) {
+            WalkState state;
+            state.root = projectPath.lexically_normal();
+            if (!state.root.has_filename() && state.root.has_relative_path()) {
+                state.root = state.root.parent_path();   // "proj/" -> "proj"
+            }
+            state.useGitignore = options.useGitignore;
+            for (const auto& pattern : options.ignorePatterns) {
+                state.rules.addPattern(pattern);
+            }
+            return state;
+        }
     }
 
     std::vector<fs::path> FileWalker::findHeaderFiles(const fs::path& projectPath) {
+        return findHeaderFiles(projectPath, WalkOptions{});
+    }
+
+    std::vector<fs::path> FileWalker::findHeaderFiles(const fs::path& projectPath, const WalkOptions& options,
+                                                      WalkStats* stats) {
         std::vector<fs::path> headers;
 
         // Validação do path de entrada
@@ -73,48 +325,108 @@ namespace serializer {
             return headers;
         }
 
+        WalkState state = makeState(projectPath, options);
+
         try {
-            size_t filesChecked = 0;
-            size_t directoriesSkipped = 0;
+            if (!options.compileCommands) {
+                loadGitignore(state.root, "", state);
+                walk(state.root, true, state, headers);
+            } else {
+                // Só olha o que o build enxerga: headers listados, vizinhos das
+                // unidades de tradução e o conteúdo dos diretórios de include
+                std::vector<fs::path> listedFiles;
+                std::vector<fs::path> sourceDirs;
+                std::vector<fs::path> includeDirs;
+                if (!readCompileCommands(*options.compileCommands, listedFiles, sourceDirs, includeDirs)) {
+                    return headers;
+                }
 
-            // Opção 1: Com skip manual (mais controle)
-            for (const auto& entry : fs::recursive_directory_iterator(
-                projectPath,
-                fs::directory_options::skip_permission_denied
-            )) {
-                filesChecked++;
+                // Descarta o que está fora do projeto e volta para a forma de projectPath
+                const fs::path absoluteRoot = fs::absolute(state.root).lexically_normal();
+                const auto toProject = [&](std::vector<fs::path>& paths) {
+                    std::vector<fs::path> inside;
+                    for (const auto& path : paths) {
+                        if (path == absoluteRoot || isInside(path, absoluteRoot)) {
+                            inside.push_back((state.root / path.lexically_relative(absoluteRoot)).lexically_normal());
+                        }
+                    }
+                    paths = std::move(inside);
+                };
+                toProject(listedFiles);
+                toProject(sourceDirs);
+                toProject(includeDirs);
+                keepOutermost(includeDirs);
 
-                // Se for diretório e estiver na lista de skip
-                if (entry.is_directory() && shouldSkipDirectory(entry.path())) {
-                    directoriesSkipped++;
-                    continue;
-                }
+                std::ranges::sort(sourceDirs);
+                sourceDirs.erase(std::ranges::unique(sourceDirs).begin(), sourceDirs.end());
 
-                if (entry.is_regular_file() && isHeaderFile(entry.path())) {
-                    headers.push_back(entry.path());
+                for (const auto& file : listedFiles) {
+                    if (isHeaderFile(file) && fs::is_regular_file(file, ec) &&
+                        enterDirectory(file.parent_path(), state) &&
+                        (state.rules.empty() || !state.rules.isIgnored(relativePath(file, state), false))) {
+                        headers.push_back(file);
+                    }
+                }
+                for (const auto& dir : sourceDirs) {
+                    if (fs::is_directory(dir, ec) && enterDirectory(dir, state)) {
+                        walk(dir, false, state, headers);
+                    }
+                }
+                for (const auto& dir : includeDirs) {
+                    if (fs::is_directory(dir, ec) && enterDirectory(dir, state)) {
+                        walk(dir, true, state, headers);
+                    }
                 }
             }
 
             // std::cout << "📊 Total: " << headers.size()
-            //           << " headers encontrados em " << filesChecked << " arquivos\n";
-            // std::cout << "⏭️  Diretórios ignorados: " << directoriesSkipped << "\n";
+            //           << " headers encontrados em " << state.filesChecked << " arquivos\n";
+            // std::cout << "⏭️  Diretórios ignorados: " << state.directoriesSkipped << "\n";
 
         } catch (const fs::filesystem_error& e) {
             std::cerr << "Erro ao percorrer diretórios: " << e.what() << "\n";
         }
 
+        if (stats) {
+            stats->entriesVisited = state.filesChecked;
+            stats->directoriesSkipped = state.directoriesSkipped;
+        }
+
+        // A ordem do diretório depende do sistema de arquivos: ordena para a saída ser estável
+        std::ranges::sort(headers);
+        headers.erase(std::ranges::unique(headers).begin(), headers.end());
+
         return headers;
     }
 
-    bool FileWalker::isHeaderFile(const fs::path& path) {
-        const std::string ext = toLower(path.extension().string());
+    std::vector<fs::path> FileWalker::findDirectories(const fs::path& projectPath, const WalkOptions& options,
+                                                      const fs::path& start, std::vector<fs::path>* headers) {
+        std::vector<fs::path> directories;
+        std::vector<fs::path> ignoredHeaders;
+        std::vector<fs::path>& found = headers ? *headers : ignoredHeaders;
 
-        for (const auto& headerExt : HEADER_EXTENSIONS) {
-            if (ext == headerExt) {
-                return true;
+        std::error_code ec;
+        if (!fs::is_directory(projectPath, ec)) {
+            return directories;
+        }
+
+        WalkState state = makeState(projectPath, options);
+        const fs::path from = start.empty() ? state.root : start;
+        try {
+            // Subdiretório: as regras continuam relativas à raiz, e ele mesmo pode estar podado
+            if (!fs::is_directory(from, ec) || !enterDirectory(from, state)) {
+                return directories;
             }
+            directories.push_back(from);
+            walk(from, true, state, found, &directories);
+        } catch (const fs::filesystem_error& e) {
+            std::cerr << "Erro ao percorrer diretórios: " << e.what() << "\n";
         }
 
-        return false;
+        return directories;
+    }
+
+    bool FileWalker::isHeaderFile(const fs::path& path) {
+        return hasHeaderExtension(path);
     }
-}
\ No newline at end of file
+}
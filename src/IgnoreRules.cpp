@@ -0,0 +1,188 @@
+//
+// Created by bruno on 16/10/2026.
+//
+#include "include/IgnoreRules.h"
+#include "include/SourceFile.h"
+
+namespace serializer {
+    namespace {
+        // Casa uma classe "[...]" no início de pattern; devolve o tamanho consumido (0 = classe inválida)
+        size_t matchCharClass(std::string_view pattern, char c, bool& matched) {
+            size_t i = 1;
+            bool negated = false;
+            if (i < pattern.size() && (pattern[i] == '!' || pattern[i] == '^')) {
+                negated = true;
+                ++i;
+            }
+
+            bool found = false;
+            bool first = true;
+            while (i < pattern.size() && (first || pattern[i] != ']')) {
+                first = false;
+                char low = pattern[i];
+                if (low == '\\' && i + 1 < pattern.size()) low = pattern[++i];
+                char high = low;
+                if (i + 2 < pattern.size() && pattern[i + 1] == '-' && pattern[i + 2] != ']') {
+                    high = pattern[i + 2];
+                    if (high == '\\' && i + 3 < pattern.size()) {
+                        high = pattern[i + 3];
+                        ++i;
+                    }
+                    i += 2;
+                }
+                if (c >= low && c <= high) found = true;
+                ++i;
+            }
+
+            if (i >= pattern.size()) {
+                return 0;   // Sem "]": o "[" é literal
+            }
+            matched = found != negated && c != '/';
+            return i + 1;
+        }
+    }
+
+    bool IgnoreRules::matchGlob(std::string_view pattern, std::string_view text) {
+        size_t p = 0;
+        size_t t = 0;
+
+        while (p < pattern.size()) {
+            char c = pattern[p];
+
+            if (c == '*') {
+                if (p + 1 < pattern.size() && pattern[p + 1] == '*') {
+                    std::string_view rest = pattern.substr(p + 2);
+                    if (!rest.empty() && rest.front() == '/') {
+                        // "**/": zero ou mais diretórios inteiros
+                        rest.remove_prefix(1);
+                        for (size_t i = t; i <= text.size(); ++i) {
+                            if ((i == t || text[i - 1] == '/') && matchGlob(rest, text.substr(i))) {
+                                return true;
+                            }
+                        }
+                        return false;
+                    }
+                    for (size_t i = t; i <= text.size(); ++i) {
+                        if (matchGlob(rest, text.substr(i))) return true;
+                    }
+                    return false;
+                }
+
+                // "*" simples: não atravessa "/"
+                const std::string_view rest = pattern.substr(p + 1);
+                for (size_t i = t; i <= text.size(); ++i) {
+                    if (matchGlob(rest, text.substr(i))) return true;
+                    if (i < text.size() && text[i] == '/') break;
+                }
+                return false;
+            }
+
+            if (t >= text.size()) {
+                return false;
+            }
+
+            if (c == '?') {
+                if (text[t] == '/') return false;
+                ++p;
+                ++t;
+                continue;
+            }
+
+            if (c == '[') {
+                bool matched = false;
+                if (const size_t used = matchCharClass(pattern.substr(p), text[t], matched); used != 0) {
+                    if (!matched) return false;
+                    p += used;
+                    ++t;
+                    continue;
+                }
+            }
+
+            if (c == '\\' && p + 1 < pattern.size()) {
+                c = pattern[++p];
+            }
+            if (text[t] != c) {
+                return false;
+            }
+            ++p;
+            ++t;
+        }
+
+        return t == text.size();
+    }
+
+    void IgnoreRules::addPattern(std::string_view pattern, const std::string& base) {
+        if (!pattern.empty() && pattern.back() == '\r') pattern.remove_suffix(1);
+
+        // Espaços no fim são ignorados, a não ser que escapados
+        while (!pattern.empty() && pattern.back() == ' ' &&
+               !(pattern.size() >= 2 && pattern[pattern.size() - 2] == '\\')) {
+            pattern.remove_suffix(1);
+        }
+        if (pattern.empty() || pattern.front() == '#') {
+            return;
+        }
+
+        Rule rule;
+        rule.base = base;
+
+        if (pattern.front() == '!') {
+            rule.negated = true;
+            pattern.remove_prefix(1);
+        } else if (pattern.starts_with("\\!") || pattern.starts_with("\\#")) {
+            pattern.remove_prefix(1);
+        }
+
+        if (!pattern.empty() && pattern.back() == '/') {
+            rule.directoryOnly = true;
+            pattern.remove_suffix(1);
+        }
+        if (pattern.empty()) {
+            return;
+        }
+
+        // Sem "/" no meio o padrão vale em qualquer nível; com "/" é relativo ao .gitignore
+        if (pattern.find('/') == std::string_view::npos) {
+            rule.pattern = "**/";
+            rule.pattern += pattern;
+        } else {
+            if (pattern.front() == '/') pattern.remove_prefix(1);
+            rule.pattern = pattern;
+        }
+
+        rules_.push_back(std::move(rule));
+    }
+
+    bool IgnoreRules::loadFile(const std::filesystem::path& file, const std::string& base) {
+        const auto source = SourceFile::open(file);
+        if (!source) {
+            return false;
+        }
+
+        const std::string_view content = source->content();
+        size_t lineStart = 0;
+        while (lineStart < content.size()) {
+            size_t lineEnd = content.find('\n', lineStart);
+            if (lineEnd == std::string_view::npos) lineEnd = content.size();
+            addPattern(content.substr(lineStart, lineEnd - lineStart), base);
+            lineStart = lineEnd + 1;
+        }
+        return true;
+    }
+
+    bool IgnoreRules::isIgnored(std::string_view relativePath, bool isDirectory) const {
+        bool ignored = false;
+
+        for (const auto& rule : rules_) {
+            if (ignored != rule.negated) continue;   // Não mudaria o resultado
+            if (rule.directoryOnly && !isDirectory) continue;
+            if (!relativePath.starts_with(rule.base)) continue;
+
+            if (matchGlob(rule.pattern, relativePath.substr(rule.base.size()))) {
+                ignored = !rule.negated;
+            }
+        }
+
+        return ignored;
+    }
+}
@@ -0,0 +1,213 @@
+//
+// Created by bruno on 16/10/2026.
+//
+#include <array>
+
+#include "include/Lexer.h"
+
+namespace serializer {
+    namespace {
+        // Tabela de caracteres de identificador (bytes >= 0x80 contam: UTF-8 em nomes)
+        constexpr std::array<bool, 256> IDENTIFIER_CHARS = [] {
+            std::array<bool, 256> table{};
+            for (int c = 0; c < 256; ++c) {
+                table[c] = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                           (c >= '0' && c <= '9') || c == '_' || c >= 0x80;
+            }
+            return table;
+        }();
+
+        bool isIdentifierChar(char c) {
+            return IDENTIFIER_CHARS[static_cast<unsigned char>(c)];
+        }
+
+        bool isDigit(char c) {
+            return c >= '0' && c <= '9';
+        }
+
+        // Prefixos de literal: u8"...", L'x', R"(...)", u8R"x(...)x"
+        bool isStringPrefix(std::string_view id) {
+            return id == "u8" || id == "u" || id == "U" || id == "L";
+        }
+
+        bool isRawPrefix(std::string_view id) {
+            return id == "R" || id == "u8R" || id == "uR" || id == "UR" || id == "LR";
+        }
+    }
+
+    Lexer::Lexer(std::string_view source, size_t offset)
+        : source_(source), pos_(offset), consumedEnd_(offset) {
+        current_ = scan();
+    }
+
+    bool Lexer::skipTrivia() {
+        const size_t start = pos_;
+        const char* const data = source_.data();
+        const size_t size = source_.size();
+
+        // Índice local no laço: o compilador não precisa regravar pos_ a cada caractere
+        size_t pos = pos_;
+        while (pos < size) {
+            const char c = data[pos];
+            if (c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v') {
+                pos++;
+            } else if (c == '\n') {
+                pos++;
+                atLineStart_ = true;
+            } else if (c == '/' && pos + 1 < size && data[pos + 1] == '/') {
+                const size_t end = source_.find('\n', pos);
+                pos = end == std::string_view::npos ? size : end;
+            } else if (c == '/' && pos + 1 < size && data[pos + 1] == '*') {
+                const size_t end = source_.find("*/", pos + 2);
+                pos = end == std::string_view::npos ? size : end + 2;
+            } else if (c == '#' && atLineStart_) {
+                pos_ = pos;
+                skipDirective();
+                pos = pos_;
+            } else if (c == '\\' && pos + 1 < size && data[pos + 1] == '\n') {
+                pos += 2;   // Continuação de linha solta
+            } else {
+                break;
+            }
+        }
+
+        pos_ = pos;
+        return pos_ != start;
+    }
+
+    void Lexer::skipDirective() {
+        // Vai até o fim da linha lógica: '\' no fim continua a diretiva
+        while (pos_ < source_.size()) {
+            const char c = source_[pos_];
+            if (c == '\n') {
+                size_t last = pos_;
+                if (last > 0 && source_[last - 1] == '\r') last--;
+                if (last > 0 && source_[last - 1] == '\\') {
+                    pos_++;
+                    continue;
+                }
+                return;   // O '\n' fica para skipTrivia marcar o início de linha
+            }
+            if (c == '/' && pos_ + 1 < source_.size() && source_[pos_ + 1] == '*') {
+                const size_t end = source_.find("*/", pos_ + 2);
+                pos_ = end == std::string_view::npos ? source_.size() : end + 2;
+                continue;
+            }
+            pos_++;
+        }
+    }
+
+    size_t Lexer::scanQuoted(size_t pos, char quote) const {
+        size_t i = pos + 1;
+        while (i < source_.size()) {
+            const char c = source_[i];
+            if (c == '\\') {
+                i += 2;
+            } else if (c == quote) {
+                return i + 1;
+            } else if (c == '\n') {
+                return i;   // Literal não terminado: não atravessa a linha
+            } else {
+                i++;
+            }
+        }
+        return source_.size();
+    }
+
+    size_t Lexer::scanRawString(size_t pos) const {
+        // pos aponta para o '"': R"delim( ... )delim"
+        const size_t open = source_.find('(', pos + 1);
+        if (open == std::string_view::npos) {
+            return source_.size();
+        }
+
+        const std::string_view delimiter = source_.substr(pos + 1, open - pos - 1);
+        size_t close = source_.find(')', open + 1);
+        while (close != std::string_view::npos) {
+            const size_t quote = close + 1 + delimiter.size();
+            if (quote < source_.size() && source_[quote] == '"' &&
+                source_.substr(close + 1, delimiter.size()) == delimiter) {
+                return quote + 1;
+            }
+            close = source_.find(')', close + 1);
+        }
+        return source_.size();
+    }
+
+    void Lexer::appendSpelling(std::string& out, const Token* previous, const Token& token) {
+        if (previous) {
+            const bool words = (previous->kind == TokenKind::Identifier || previous->kind == TokenKind::Number) &&
+                               (token.kind == TokenKind::Identifier || token.kind == TokenKind::Number);
+            if (words || previous->is(',')) {
+                out += ' ';
+            }
+        }
+        out += token.text;
+    }
+
+    Token Lexer::scan() {
+        Token token;
+        token.spaceBefore = skipTrivia();
+
+        if (pos_ >= source_.size()) {
+            token.kind = TokenKind::End;
+            token.text = source_.substr(source_.size());
+            return token;
+        }
+
+        atLineStart_ = false;
+        const size_t start = pos_;
+        const char c = source_[pos_];
+
+        if (isDigit(c) || (c == '.' && pos_ + 1 < source_.size() && isDigit(source_[pos_ + 1]))) {
+            // pp-number: dígitos, letras, '.', separador ' e sinal de expoente
+            token.kind = TokenKind::Number;
+            pos_++;
+            while (pos_ < source_.size()) {
+                const char d = source_[pos_];
+                const char prev = source_[pos_ - 1];
+                if (isIdentifierChar(d) || d == '.') {
+                    pos_++;
+                } else if ((d == '+' || d == '-') &&
+                           (prev == 'e' || prev == 'E' || prev == 'p' || prev == 'P')) {
+                    pos_++;
+                } else if (d == '\'' && pos_ + 1 < source_.size() && isIdentifierChar(source_[pos_ + 1])) {
+                    pos_++;
+                } else {
+                    break;
+                }
+            }
+        } else if (isIdentifierChar(c)) {
+            token.kind = TokenKind::Identifier;
+            size_t end = pos_ + 1;
+            while (end < source_.size() && isIdentifierChar(source_[end])) {
+                end++;
+            }
+            pos_ = end;
+
+            if (pos_ < source_.size()) {
+                const std::string_view id = source_.substr(start, pos_ - start);
+                const char quote = source_[pos_];
+                if (quote == '"' && isRawPrefix(id)) {
+                    token.kind = TokenKind::Literal;
+                    pos_ = scanRawString(pos_);
+                } else if ((quote == '"' || quote == '\'') && isStringPrefix(id)) {
+                    token.kind = TokenKind::Literal;
+                    pos_ = scanQuoted(pos_, quote);
+                }
+            }
+        } else if (c == '"' || c == '\'') {
+            token.kind = TokenKind::Literal;
+            pos_ = scanQuoted(pos_, c);
+        } else if (c == ':' && pos_ + 1 < source_.size() && source_[pos_ + 1] == ':') {
+            token.kind = TokenKind::Punct;
+            pos_ += 2;
+        } else {
+            token.kind = TokenKind::Punct;
+            pos_++;
+        }
+
+        token.text = std::string_view(source_.data() + start, pos_ - start);
+        return token;
+    }
+}
@@ -0,0 +1,127 @@
+//
+// Created by bruno on 16/10/2026.
+//
+#include <bit>
+#include <cstring>
+
+#include "include/MarkerScanner.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CPP_SERIALIZER_HAS_SSE2 1
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define CPP_SERIALIZER_HAS_AVX2 1
+#endif
+#endif
+
+namespace serializer {
+    namespace {
+        using FindFunction = size_t (*)(const char*, size_t, std::string_view);
+
+        size_t findScalar(const char* data, size_t size, std::string_view needle) {
+            return std::string_view(data, size).find(needle);
+        }
+
+#ifdef CPP_SERIALIZER_HAS_SSE2
+        // Confirma os candidatos de uma máscara (bit i = primeiro e último caractere batem em base + i)
+        inline size_t verifyCandidates(const char* data, size_t base, unsigned mask, std::string_view needle) {
+            while (mask != 0) {
+                const size_t offset = base + static_cast<size_t>(std::countr_zero(mask));
+                if (std::memcmp(data + offset + 1, needle.data() + 1, needle.size() - 2) == 0) {
+                    return offset;
+                }
+                mask &= mask - 1;
+            }
+            return std::string_view::npos;
+        }
+
+        size_t findSse2(const char* data, size_t size, std::string_view needle) {
+            const size_t last = needle.size() - 1;
+            const __m128i firstChar = _mm_set1_epi8(needle.front());
+            const __m128i lastChar = _mm_set1_epi8(needle.back());
+
+            size_t i = 0;
+            for (; i + last + 16 <= size; i += 16) {
+                const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + last));
+                const __m128i both = _mm_and_si128(_mm_cmpeq_epi8(firstChar, blockFirst),
+                                                   _mm_cmpeq_epi8(lastChar, blockLast));
+                const auto mask = static_cast<unsigned>(_mm_movemask_epi8(both));
+                if (mask != 0) {
+                    const size_t found = verifyCandidates(data, i, mask, needle);
+                    if (found != std::string_view::npos) return found;
+                }
+            }
+
+            // Cauda menor que um bloco
+            const size_t rest = findScalar(data + i, size - i, needle);
+            return rest == std::string_view::npos ? rest : i + rest;
+        }
+#endif
+
+#ifdef CPP_SERIALIZER_HAS_AVX2
+        __attribute__((target("avx2")))
+        size_t findAvx2(const char* data, size_t size, std::string_view needle) {
+            const size_t last = needle.size() - 1;
+            const __m256i firstChar = _mm256_set1_epi8(needle.front());
+            const __m256i lastChar = _mm256_set1_epi8(needle.back());
+
+            size_t i = 0;
+            for (; i + last + 32 <= size; i += 32) {
+                const __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + last));
+                const __m256i both = _mm256_and_si256(_mm256_cmpeq_epi8(firstChar, blockFirst),
+                                                      _mm256_cmpeq_epi8(lastChar, blockLast));
+                const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(both));
+                if (mask != 0) {
+                    const size_t found = verifyCandidates(data, i, mask, needle);
+                    if (found != std::string_view::npos) return found;
+                }
+            }
+
+            const size_t rest = findSse2(data + i, size - i, needle);
+            return rest == std::string_view::npos ? rest : i + rest;
+        }
+#endif
+
+        struct Implementation {
+            FindFunction find;
+            const char* name;
+        };
+
+        Implementation selectImplementation() {
+#ifdef CPP_SERIALIZER_HAS_AVX2
+            if (__builtin_cpu_supports("avx2")) {
+                return {findAvx2, "avx2"};
+            }
+#endif
+#ifdef CPP_SERIALIZER_HAS_SSE2
+            return {findSse2, "sse2"};   // Sempre presente em x86-64
+#else
+            return {findScalar, "scalar"};
+#endif
+        }
+
+        const Implementation& implementationForCpu() {
+            static const Implementation selected = selectImplementation();
+            return selected;
+        }
+    }
+
+    size_t MarkerScanner::find(std::string_view haystack, std::string_view needle, size_t from) {
+        if (from >= haystack.size()) {
+            return needle.empty() && from == haystack.size() ? from : std::string_view::npos;
+        }
+        // Os kernels comparam primeiro e último caractere: marcadores curtos ficam no find comum
+        if (needle.size() < 2) {
+            return haystack.find(needle, from);
+        }
+
+        const size_t found = implementationForCpu().find(haystack.data() + from, haystack.size() - from, needle);
+        return found == std::string_view::npos ? found : from + found;
+    }
+
+    const char* MarkerScanner::implementation() {
+        return implementationForCpu().name;
+    }
+}
@@ -0,0 +1,142 @@
+//
+// Created by bruno on 16/10/2026.
+//
+#include <algorithm>
+#include <charconv>
+#include <iostream>
+#include <string_view>
+#include <thread>
+
+#include "include/Options.h"
+
+namespace serializer {
+    namespace {
+        bool parseJobs(std::string_view text, unsigned& jobs) {
+            unsigned value = 0;
+            auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (ec != std::errc() || end != text.data() + text.size()) {
+                return false;
+            }
+            jobs = value != 0 ? value : std::max(1u, std::thread::hardware_concurrency());
+            return true;
+        }
+    }
+
+    void printUsage(const char* program) {
+        std::cerr << "Uso: " << program << " [opções] <caminho-do-projeto>\n";
+        std::cerr << "Exemplo: " << program << " ./meu_projeto\n\n";
+        std::cerr << "Opções:\n";
+        std::cerr << "  --pmr                    gera sobrecargas de desserialização com std::pmr::memory_resource\n";
+        std::cerr << "  --non-intrusive          gera funções livres (to_json/from_json...) e não modifica os headers\n";
+        std::cerr << "  --out-of-line            gera um .cpp por classe com os corpos; o header gerado só declara\n";
+        std::cerr << "  --jobs N                 analisa os headers com N threads (0 = um por núcleo)\n";
+        std::cerr << "  --watch                  continua rodando e regera as classes alteradas (inotify)\n";
+        std::cerr << "  --no-cache               parseia todos os headers, sem usar nem gravar o cache\n";
+        std::cerr << "  --ignore GLOB            ignora caminhos (sintaxe do .gitignore, pode repetir)\n";
+        std::cerr << "  --no-gitignore           não aplica os arquivos .gitignore do projeto\n";
+        std::cerr << "  --compile-commands ARQ   usa o compile_commands.json em vez de varrer o projeto\n";
+        std::cerr << "  --profile[=table|json]   mede cada fase e imprime tempos e contadores\n";
+        std::cerr << "  --profile-out ARQ        grava o relatório do --profile em ARQ (JSON se não indicado)\n";
+        std::cerr << "  --depfile ARQ            grava em ARQ os headers das classes (formato make), para o Ninja/Make\n";
+        std::cerr << "  --manifest ARQ           grava em ARQ, em JSON, os arquivos gerados por header\n";
+    }
+
+    std::optional<Options> parseOptions(int argc, char* argv[]) {
+        Options options;
+        bool hasPath = false;
+
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view arg = argv[i];
+
+            if (arg == "--pmr") {
+                options.generatePmr = true;
+            } else if (arg == "--non-intrusive") {
+                options.nonIntrusive = true;
+            } else if (arg == "--out-of-line") {
+                options.outOfLine = true;
+            } else if (arg == "--jobs" || arg == "-j") {
+                if (i + 1 >= argc || !parseJobs(argv[i + 1], options.jobs)) {
+                    std::cerr << "❌ " << arg << " espera um número\n";
+                    return std::nullopt;
+                }
+                ++i;
+            } else if (arg.starts_with("--jobs=")) {
+                if (!parseJobs(arg.substr(7), options.jobs)) {
+                    std::cerr << "❌ --jobs espera um número\n";
+                    return std::nullopt;
+                }
+            } else if (arg == "--profile" || arg == "--profile=table") {
+                options.profile = ProfileFormat::Table;
+            } else if (arg == "--profile=json") {
+                options.profile = ProfileFormat::Json;
+            } else if (arg.starts_with("--profile=")) {
+                std::cerr << "❌ --profile aceita table ou json\n";
+                return std::nullopt;
+            } else if (arg == "--profile-out") {
+                if (i + 1 >= argc) {
+                    std::cerr << "❌ " << arg << " espera um valor\n";
+                    return std::nullopt;
+                }
+                options.profileOutput = argv[++i];
+            } else if (arg.starts_with("--profile-out=")) {
+                options.profileOutput = arg.substr(14);
+            } else if (arg == "--depfile" || arg == "--manifest") {
+                if (i + 1 >= argc) {
+                    std::cerr << "❌ " << arg << " espera um valor\n";
+                    return std::nullopt;
+                }
+                if (arg == "--depfile") {
+                    options.depfile = argv[++i];
+                } else {
+                    options.manifest = argv[++i];
+                }
+            } else if (arg.starts_with("--depfile=")) {
+                options.depfile = arg.substr(10);
+            } else if (arg.starts_with("--manifest=")) {
+                options.manifest = arg.substr(11);
+            } else if (arg == "--ignore" || arg == "--compile-commands") {
+                if (i + 1 >= argc) {
+                    std::cerr << "❌ " << arg << " espera um valor\n";
+                    return std::nullopt;
+                }
+                if (arg == "--ignore") {
+                    options.walk.ignorePatterns.emplace_back(argv[++i]);
+                } else {
+                    options.walk.compileCommands = argv[++i];
+                }
+            } else if (arg.starts_with("--ignore=")) {
+                options.walk.ignorePatterns.emplace_back(arg.substr(9));
+            } else if (arg.starts_with("--compile-commands=")) {
+                options.walk.compileCommands = arg.substr(19);
+            } else if (arg == "--watch") {
+                options.watch = true;
+            } else if (arg == "--no-cache") {
+                options.useCache = false;
+            } else if (arg == "--no-gitignore") {
+                options.walk.useGitignore = false;
+            } else if (arg.starts_with("-")) {
+                std::cerr << "❌ Opção desconhecida: " << arg << "\n";
+                printUsage(argv[0]);
+                return std::nullopt;
+            } else if (!hasPath) {
+                options.projectPath = arg;
+                hasPath = true;
+            } else {
+                printUsage(argv[0]);
+                return std::nullopt;
+            }
+        }
+
+        if (!hasPath) {
+            printUsage(argv[0]);
+            return std::nullopt;
+        }
+
+        // Arquivo de relatório sem formato: JSON, que é o que CI costuma ler
+        if (options.profileOutput && options.profile == ProfileFormat::None) {
+            options.profile = ProfileFormat::Json;
+        }
+
+        return options;
+    }
+}
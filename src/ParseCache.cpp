@@ -0,0 +1,237 @@
+//
+// Created by bruno on 16/10/2026.
+//
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+#include "include/ParseCache.h"
+#include "include/SourceFile.h"
+#include "include/WireFormat.h"
+
+namespace fs = std::filesystem;
+
+namespace serializer {
+    namespace {
+        // Data com margem: arquivos alterados perto da gravação do cache sempre passam pelo hash
+        constexpr auto RACY_WINDOW = std::chrono::seconds(2);
+
+        // Adaptadores para escrever e ler o ClassInfo com a mesma lista de campos
+        struct CacheOut {
+            WireWriter& out;
+
+            template<typename T>
+            void operator()(const T& v) { out.value(v); }
+
+            void path(const fs::path& p) { out.value(p.generic_string()); }
+
+            template<typename Vector>
+            size_t count(const Vector& items) {
+                out.varint(items.size());
+                return items.size();
+            }
+        };
+
+        struct CacheIn {
+            WireReader& in;
+
+            template<typename T>
+            void operator()(T& v) { in.read(v); }
+
+            void path(fs::path& p) {
+                std::string text;
+                in.read(text);
+                p = text;
+            }
+
+            template<typename Vector>
+            size_t count(Vector& items) {
+                const uint64_t n = in.varint();
+                if (n > in.remaining()) {
+                    throw WireFormatError("quantidade inválida no cache");
+                }
+                items.resize(n);
+                return n;
+            }
+        };
+
+        template<typename Io, typename Field>
+        void transfer(Io& io, Field& f) {
+            io(f.type);
+            io(f.name);
+            io(f.access);
+            io(f.isTransient);
+            io(f.isPointer);
+            io(f.isContainer);
+            io(f.containerElementTypes);
+        }
+
+        template<typename Io, typename Base>
+        void transferBase(Io& io, Base& b) {
+            io(b.name);
+            io(b.access);
+            io(b.isVirtual);
+        }
+
+        template<typename Io, typename Method>
+        void transferMethod(Io& io, Method& m) {
+            io(m.returnType);
+            io(m.name);
+            io(m.parameters);
+            io(m.isVirtual);
+            io(m.isPureVirtual);
+            io(m.isConst);
+        }
+
+        template<typename Io, typename Info>
+        void transferClass(Io& io, Info& c) {
+            io(c.name);
+            io(c.qualifiedName);
+            io.path(c.sourceFile);
+            io(c.isStruct);
+            io(c.bodyBegin);
+            io(c.bodyEnd);
+
+            const size_t fields = io.count(c.fields);
+            for (size_t i = 0; i < fields; ++i) transfer(io, c.fields[i]);
+            const size_t bases = io.count(c.baseClasses);
+            for (size_t i = 0; i < bases; ++i) transferBase(io, c.baseClasses[i]);
+            const size_t methods = io.count(c.methods);
+            for (size_t i = 0; i < methods; ++i) transferMethod(io, c.methods[i]);
+
+            io(c.namespaces);
+            io(c.dependencies);
+            io(c.dependents);
+            io(c.hasCircularDependency);
+            io(c.maxNestingDepth);
+            io(c.needsCustomSerialization);
+            io(c.customSerializers);
+            io(c.isTemplate);
+            io(c.templateParameters);
+        }
+
+        int64_t now() {
+            return fs::file_time_type::clock::now().time_since_epoch().count();
+        }
+    }
+
+    bool ParseCache::load() {
+        entries_.clear();
+
+        const auto source = SourceFile::open(file_);
+        if (!source) {
+            return false;
+        }
+
+        try {
+            WireReader in(source->content());
+            std::string version;
+            in.read(version);
+            if (version != GENERATOR_VERSION) {
+                return false;   // Outro gerador: tudo é parseado de novo
+            }
+            in.read(savedAt_);
+
+            const uint64_t count = in.varint();
+            for (uint64_t i = 0; i < count; ++i) {
+                std::string header;
+                Entry entry;
+                in.read(header);
+                in.read(entry.size);
+                in.read(entry.modified);
+                in.read(entry.hash);
+                in.read(entry.hasMacro);
+                if (in.byte()) {
+                    CacheIn io{in};
+                    transferClass(io, entry.classInfo.emplace());
+                }
+                entries_.emplace(std::move(header), std::move(entry));
+            }
+            in.finish();
+        } catch (const WireFormatError& e) {
+            std::cerr << "⚠️  Cache inválido, ignorando: " << e.what() << "\n";
+            entries_.clear();
+            return false;
+        }
+
+        return !entries_.empty();
+    }
+
+    bool ParseCache::save() {
+        std::string buffer;
+        WireWriter out(buffer);
+        out.value(GENERATOR_VERSION);
+        savedAt_ = now();
+        out.value(savedAt_);
+
+        out.varint(entries_.size());
+        for (const auto& [header, entry] : entries_) {
+            out.value(header);
+            out.value(entry.size);
+            out.value(entry.modified);
+            out.value(entry.hash);
+            out.value(entry.hasMacro);
+            out.byte(entry.classInfo ? 1 : 0);
+            if (entry.classInfo) {
+                CacheOut io{out};
+                transferClass(io, *entry.classInfo);
+            }
+        }
+
+        std::error_code ec;
+        fs::create_directories(file_.parent_path(), ec);
+
+        fs::path temporary = file_;
+        temporary += ".tmp";
+        {
+            std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+            if (!stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+                return false;
+            }
+        }
+        fs::rename(temporary, file_, ec);
+        return !ec;
+    }
+
+    const ParseCache::Entry* ParseCache::find(const fs::path& header, const Entry& current) const {
+        const auto it = entries_.find(header.string());
+        if (it == entries_.end() || it->second.size != current.size) {
+            return nullptr;
+        }
+
+        const Entry& cached = it->second;
+        const int64_t racyLimit = savedAt_ - std::chrono::duration_cast<fs::file_time_type::duration>(RACY_WINDOW).count();
+        if (cached.modified == current.modified && current.modified < racyLimit) {
+            return &cached;
+        }
+        if (current.hash != 0 && cached.hash == current.hash) {
+            return &cached;
+        }
+        return nullptr;
+    }
+
+    void ParseCache::store(const fs::path& header, Entry entry) {
+        entries_.insert_or_assign(header.string(), std::move(entry));
+    }
+
+    bool ParseCache::stamp(const fs::path& file, Entry& entry) {
+        std::error_code ec;
+        const auto size = fs::file_size(file, ec);
+        if (ec) return false;
+        const auto modified = fs::last_write_time(file, ec);
+        if (ec) return false;
+
+        entry.size = size;
+        entry.modified = modified.time_since_epoch().count();
+        return true;
+    }
+
+    uint64_t ParseCache::hashContent(std::string_view content) {
+        uint64_t hash = 14695981039346656037ull;
+        for (const char c : content) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash != 0 ? hash : 1;   // 0 fica reservado para "não lido"
+    }
+}
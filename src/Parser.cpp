@@ -5,119 +5,316 @@
 #include "include/Parser.h"
 #include "include/TypeChecker.h"
 #include "include/ClassInfo.h"
+#include "include/Lexer.h"
+#include "include/MarkerScanner.h"
+#include "include/SourceFile.h"
 #include "include/Utils.h"
-#include <fstream>
 #include <algorithm>
 #include <iostream>
 
 namespace serializer {
     namespace {
-        // Extrai tipo e nome de uma declaração de campo
-        // Ex: "int id;" -> tipo="int", nome="id"
-        // Ex: "std::vector<double> valores;" -> tipo="std::vector<double>", nome="valores"
-        std::optional<std::pair<std::string, std::string>>
-        extractTypeAndName(const std::string& line) {
-            std::string cleaned = line;
-
-            // Remove TRANSIENT se existir
-            size_t transientPos = cleaned.find("TRANSIENT");
-            if (transientPos != std::string::npos) {
-                cleaned.erase(transientPos, 9); // Tamanho de "TRANSIENT"
+        constexpr std::string_view SERIALIZABLE_MACRO = "SERIALIZABLE";
+        constexpr std::string_view TRANSIENT_MACRO = "TRANSIENT";
+
+        enum class DeclarationKind {
+            Data,       // Candidata a campo: "int id;", "std::vector<T> a, b;"
+            Function,   // Método, construtor, operador (com ou sem corpo)
+            Other       // Tipos aninhados, using, friend, static, macros...
+        };
+
+        AccessSpecifier accessFromKeyword(const Token& token) {
+            if (token.is("public")) return AccessSpecifier::Public;
+            if (token.is("private")) return AccessSpecifier::Private;
+            if (token.is("protected")) return AccessSpecifier::Protected;
+            return AccessSpecifier::None;
+        }
+
+        // Declarações que nunca viram campo serializável
+        bool startsNonData(const Token& token) {
+            return token.is("class") || token.is("struct") || token.is("union") || token.is("enum") ||
+                   token.is("using") || token.is("typedef") || token.is("friend") || token.is("template") ||
+                   token.is("static") || token.is("constexpr") || token.is("static_assert");
+        }
+
+        // Parênteses depois destas palavras não fazem da declaração uma função
+        bool isParenKeyword(const Token& token) {
+            return token.is("alignas") || token.is("decltype") || token.is("__attribute__") ||
+                   token.is("__declspec") || token.is("noexcept");
+        }
+
+        // Qualificadores removidos do tipo do campo (o gerador trabalha com o tipo "puro")
+        bool isDroppedQualifier(const Token& token) {
+            return token.is("mutable") || token.is("const") || token.is("volatile") || token.is("inline");
+        }
+
+        // Consome tokens até fechar o grupo aberto (o token de abertura já foi consumido)
+        void skipGroup(Lexer& lexer, char open, char close) {
+            int depth = 1;
+            while (depth > 0) {
+                const Token token = lexer.next();
+                if (token.isEnd()) return;
+                if (token.is(open)) depth++;
+                else if (token.is(close)) depth--;
             }
+        }
 
-            // Remove "mutable", "static", "constexpr", etc
-            const std::vector<std::string> modifiers = {
-                "mutable", "static", "constexpr", "const", "volatile", "inline"
-            };
+        /**
+         * Lê uma declaração de membro inteira (pode ocupar várias linhas) para tokens.
+         * Corpos de métodos são pulados sem serem guardados. Para no '}' que fecha
+         * a classe, sem consumi-lo.
+         */
+        DeclarationKind readDeclaration(Lexer& lexer, std::vector<Token>& tokens) {
+            tokens.clear();
+
+            int nest = 0;               // ( [ {
+            int angle = 0;              // < > de template (fora de inicializadores)
+            bool initializer = false;   // Depois de '=' até a próxima vírgula
+            bool function = false;
+            bool constructorInit = false;
+            bool other = false;
+            bool afterOperator = false;
+            bool onlyTransient = true;
+
+            while (true) {
+                const Token& upcoming = lexer.peek();
+                if (upcoming.isEnd() || (nest == 0 && upcoming.is('}'))) break;
+
+                // "TRANSIENT" solto antes de um especificador de acesso não vale para depois dele
+                if (nest == 0 && onlyTransient && !tokens.empty() &&
+                    accessFromKeyword(upcoming) != AccessSpecifier::None) {
+                    return DeclarationKind::Other;
+                }
 
-            for (const auto& mod : modifiers) {
-                size_t pos = cleaned.find(mod);
-                if (pos != std::string::npos &&
-                    (cleaned[pos + mod.length()] == ' ' ||
-                     cleaned[pos + mod.length()] == '\t')) {
-                    cleaned.erase(pos, mod.length());
+                const Token token = lexer.next();
+                const Token previous = tokens.empty() ? Token{} : tokens.back();   // Cópia: tokens pode realocar
+                if (!token.is(TRANSIENT_MACRO)) onlyTransient = false;
+
+                if (tokens.empty()) {
+                    // SERIALIZABLE(Nome) dentro do corpo é só o marcador, sem ';'
+                    if (token.is(SERIALIZABLE_MACRO) && lexer.peek().is('(')) {
+                        lexer.next();
+                        skipGroup(lexer, '(', ')');
+                        return DeclarationKind::Other;
+                    }
+                    other = startsNonData(token);
                 }
-            }
 
-            cleaned = Utils::trim(cleaned);
+                if (token.is('(') || token.is('[') || token.is('{')) {
+                    if (nest == 0 && angle == 0 && !initializer) {
+                        if (token.is('(') && !afterOperator && !isParenKeyword(previous)) {
+                            function = true;
+                        }
+                        if (token.is('(')) afterOperator = false;
+
+                        const bool body = token.is('{') && function &&
+                                          (!constructorInit || previous.is(')') || previous.is('}'));
+                        if (body) {
+                            skipGroup(lexer, '{', '}');
+                            return DeclarationKind::Function;
+                        }
+                    }
+                    tokens.push_back(token);
+                    nest++;
+                    continue;
+                }
 
-            // Remove ponto e vírgula final
-            if (!cleaned.empty() && cleaned.back() == ';') {
-                cleaned.pop_back();
-            }
+                tokens.push_back(token);
 
-            // Encontra o último espaço (separando tipo e nome)
-            size_t lastSpace = cleaned.find_last_of(" \t");
-            if (lastSpace == std::string::npos) {
-                return std::nullopt;
+                if (token.is(')') || token.is(']') || token.is('}')) {
+                    if (nest > 0) nest--;
+                    continue;
+                }
+                if (nest > 0) continue;
+
+                if (token.is(';')) break;
+
+                if (initializer) {
+                    if (token.is(',')) initializer = false;   // Próximo declarador
+                    continue;
+                }
+
+                if (token.is("operator")) {
+                    function = true;
+                    afterOperator = true;
+                } else if (afterOperator) {
+                    // operator<, operator() ...: nada aqui abre template
+                } else if (token.is('<') && previous.isIdentifier()) {
+                    angle++;
+                } else if (token.is('>') && angle > 0) {
+                    angle--;
+                } else if (token.is('=') && angle == 0) {
+                    initializer = true;
+                } else if (token.is(':') && function && angle == 0) {
+                    constructorInit = true;
+                }
             }
 
-            std::string type = Utils::trim(cleaned.substr(0, lastSpace));
-            std::string name = Utils::trim(cleaned.substr(lastSpace + 1));
+            if (function) return DeclarationKind::Function;
+            if (other) return DeclarationKind::Other;
+            return DeclarationKind::Data;
+        }
 
-            // Validação básica
-            if (type.empty() || name.empty()) {
-                return std::nullopt;
+        // Monta o texto de um intervalo de tokens com espaçamento canônico
+        void appendTokens(std::string& out, const Token* begin, const Token* end) {
+            const Token* previous = nullptr;
+            for (const Token* it = begin; it != end; ++it) {
+                Lexer::appendSpelling(out, previous, *it);
+                previous = it;
             }
+        }
 
-            // Verifica se name é válido (não pode ter parênteses, etc)
-            if (name.find('(') != std::string::npos ||
-                name.find(')') != std::string::npos ||
-                name.find('[') != std::string::npos) {
-                return std::nullopt; // Provavelmente é um método, não campo
+        /**
+         * Extrai os campos de uma declaração de dados
+         * Ex: "int id;" -> tipo="int", nome="id"
+         * Ex: "std::vector<double> valores, pesos = {};" -> dois campos std::vector<double>
+         */
+        void extractFields(
+            const std::vector<Token>& declaration,
+            std::vector<Token>& cleaned,
+            AccessSpecifier access,
+            std::vector<FieldInfo>& fields
+        ) {
+            // Tira TRANSIENT, atributos e qualificadores de nível zero
+            bool transient = false;
+            cleaned.clear();
+            int angle = 0;
+            for (size_t i = 0; i < declaration.size(); ++i) {
+                const Token& token = declaration[i];
+                if (token.is(TRANSIENT_MACRO)) {
+                    transient = true;
+                    continue;
+                }
+                if (token.is('[') && i + 1 < declaration.size() && declaration[i + 1].is('[')) {
+                    // [[atributo]]: pula até "]]"
+                    int depth = 0;
+                    for (; i < declaration.size(); ++i) {
+                        if (declaration[i].is('[')) depth++;
+                        else if (declaration[i].is(']') && --depth == 0) break;
+                    }
+                    continue;
+                }
+                if (isParenKeyword(token) && i + 1 < declaration.size() && declaration[i + 1].is('(')) {
+                    int depth = 0;
+                    for (++i; i < declaration.size(); ++i) {
+                        if (declaration[i].is('(')) depth++;
+                        else if (declaration[i].is(')') && --depth == 0) break;
+                    }
+                    continue;
+                }
+                if (angle == 0 && isDroppedQualifier(token)) continue;
+                if (token.is('<')) angle++;
+                else if (token.is('>') && angle > 0) angle--;
+                cleaned.push_back(token);
             }
+            if (!cleaned.empty() && cleaned.back().is(';')) cleaned.pop_back();
+
+            // Declaradores separados por vírgula de nível zero
+            const Token* base = cleaned.data();
+            const Token* baseTypeEnd = nullptr;   // Tipo comum, sem os '*'/'&' do primeiro declarador
+            const Token* segment = base;
+            const Token* const end = base + cleaned.size();
+            int nest = 0;
+            angle = 0;
+            bool inInitializer = false;
+
+            const auto finishDeclarator = [&](const Token* declaratorEnd) {
+                // Nome: último identificador antes de '=', '{', ':' (bitfield) ou '[' (array: não suportado)
+                const Token* nameEnd = declaratorEnd;
+                int depth = 0;
+                int angles = 0;
+                for (const Token* it = segment; it != declaratorEnd; ++it) {
+                    if (depth == 0 && angles == 0 &&
+                        (it->is('=') || it->is('{') || it->is(':') || it->is('['))) {
+                        if (it->is('[')) return;
+                        nameEnd = it;
+                        break;
+                    }
+                    if (it->is('(') || it->is('{') || it->is('[')) depth++;
+                    else if (it->is(')') || it->is('}') || it->is(']')) depth--;
+                    else if (it->is('<')) angles++;
+                    else if (it->is('>') && angles > 0) angles--;
+                }
+
+                if (nameEnd == segment) return;
+                const Token* name = nameEnd - 1;
+                if (!name->isIdentifier()) return;
+
+                FieldInfo field;
+                if (segment == base) {
+                    appendTokens(field.type, segment, name);
+                    baseTypeEnd = name;
+                    while (baseTypeEnd != base && (baseTypeEnd[-1].is('*') || baseTypeEnd[-1].is('&'))) {
+                        baseTypeEnd--;
+                    }
+                } else if (baseTypeEnd) {
+                    appendTokens(field.type, base, baseTypeEnd);
+                    for (const Token* it = segment; it != name; ++it) field.type += it->text;
+                }
+                if (field.type.empty()) return;
 
-            return std::make_pair(type, name);
+                field.name = name->text;
+                field.access = access;
+                field.isTransient = transient;
+                fields.push_back(std::move(field));
+            };
+
+            for (const Token* it = base; it != end; ++it) {
+                if (it->is('(') || it->is('{') || it->is('[')) nest++;
+                else if (it->is(')') || it->is('}') || it->is(']')) nest--;
+                else if (nest == 0 && it->is('=')) inInitializer = true;
+                else if (nest == 0 && !inInitializer && it->is('<')) angle++;
+                else if (nest == 0 && !inInitializer && it->is('>') && angle > 0) angle--;
+                else if (nest == 0 && angle == 0 && it->is(',')) {
+                    finishDeclarator(it);
+                    segment = it + 1;
+                    inInitializer = false;
+                }
+            }
+            if (segment != end) {
+                finishDeclarator(end);
+            }
         }
     }
 
     bool Parser::containsSerializableMacro(const std::filesystem::path& filePath) const {
-        std::ifstream file(filePath);
-        if (!file.is_open()) {
-            return false;
-        }
+        auto source = SourceFile::open(filePath);
+        return source && containsSerializableMacro(source->content());
+    }
 
-        std::string line;
-        while (std::getline(file, line)) {
-            // Remove comentários
-            std::string cleanLine = Utils::removeComments(line);
+    bool Parser::containsSerializableMacro(std::string_view content) const {
+        // Busca vetorizada no buffer inteiro: só olha a linha das (raras) ocorrências
+        size_t pos = MarkerScanner::find(content, SERIALIZABLE_MACRO);
+        while (pos != std::string_view::npos) {
+            size_t lineStart = content.rfind('\n', pos);
+            lineStart = lineStart == std::string_view::npos ? 0 : lineStart + 1;
 
-            // Verifica se contém SERIALIZABLE
-            if (cleanLine.find("SERIALIZABLE") != std::string::npos) {
-                file.close();
+            // Ocorrência depois de "//" está em comentário
+            if (content.substr(lineStart, pos - lineStart).find("//") == std::string_view::npos) {
                 return true;
             }
+            pos = MarkerScanner::find(content, SERIALIZABLE_MACRO, pos + SERIALIZABLE_MACRO.size());
         }
 
-        file.close();
         return false;
     }
 
-    bool Parser::containsTransient(const std::string& line) const {
-        // Verifica se a linha contém "TRANSIENT"
-        // Ignora comentários
-        std::string cleanLine = line;
-
-        // Remove comentários de linha
-        size_t commentPos = cleanLine.find("//");
-        if (commentPos != std::string::npos) {
-            cleanLine = cleanLine.substr(0, commentPos);
-        }
-
-        // Remove comentários de bloco (simplificado)
-        commentPos = cleanLine.find("/*");
-        if (commentPos != std::string::npos) {
-            cleanLine = cleanLine.substr(0, commentPos);
+    std::optional<ClassInfo> Parser::parseClass(const std::filesystem::path& filePath) const {
+        auto source = SourceFile::open(filePath);
+        if (!source) {
+            std::cerr << "Erro ao abrir: " << filePath << "\n";
+            return std::nullopt;
         }
 
-        // Verifica se contém TRANSIENT
-        return cleanLine.find("TRANSIENT") != std::string::npos;
+        return parseClass(filePath, source->content());
     }
 
-    std::optional<ClassInfo> Parser::parseClass(const std::filesystem::path& filePath) const {
-        std::ifstream file(filePath);
-        if (!file.is_open()) {
-            std::cerr << "Erro ao abrir: " << filePath << "\n";
+    std::optional<ClassInfo> Parser::parseClass(
+        const std::filesystem::path& filePath,
+        std::string_view content
+    ) const {
+        // Sem a macro no buffer (busca vetorizada) não há o que tokenizar
+        if (MarkerScanner::find(content, SERIALIZABLE_MACRO) == std::string_view::npos) {
             return std::nullopt;
         }
 
@@ -125,113 +322,119 @@ namespace serializer {
         classInfo.sourceFile = filePath;
         classInfo.isStruct = false;
 
-        std::string line;
-        bool inClass = false;
-        bool foundSerializable = false;
-        AccessSpecifier currentAccess = AccessSpecifier::Private; // class padrão é private
-        bool nextFieldIsTransient = false;
-
-        while (std::getline(file, line)) {
-            std::string cleanLine = Utils::removeComments(line);
+        // Namespaces abertos até a macro: (profundidade de chaves, quantos nomes empilhou)
+        std::vector<std::pair<int, size_t>> openNamespaces;
+        int depth = 0;
 
-            // Verifica se encontrou SERIALIZABLE
-            if (!foundSerializable && cleanLine.find("SERIALIZABLE") != std::string::npos) {
-                // Extrai nome da classe: SERIALIZABLE(Usuario)
-                size_t start = cleanLine.find('(');
-                size_t end = cleanLine.find(')');
-
-                if (start != std::string::npos && end != std::string::npos && end > start) {
-                    classInfo.name = cleanLine.substr(start + 1, end - start - 1);
-                    classInfo.name = Utils::trim(classInfo.name);
-                    foundSerializable = true;
-                }
-
-                // Verifica se é struct ou class
-                size_t classPos = cleanLine.find("class");
-                size_t structPos = cleanLine.find("struct");
-
-                if (structPos != std::string::npos &&
-                    (classPos == std::string::npos || structPos < classPos)) {
-                    classInfo.isStruct = true;
-                    currentAccess = AccessSpecifier::Public; // structs são public por padrão
-                }
-
-                inClass = true;
+        // Comentários e diretivas já saem do lexer: "#define SERIALIZABLE(...)" não conta
+        Lexer lexer(content);
+        while (true) {
+            const Token token = lexer.next();
+            if (token.isEnd()) {
+                return std::nullopt;
+            }
+            if (token.is('{')) {
+                depth++;
                 continue;
             }
-
-            if (!inClass) continue;
-
-            // Verifica se saiu da classe
-            if (cleanLine.find('}') != std::string::npos &&
-                cleanLine.find(';') != std::string::npos) {
-                break; // Fim da classe: "};"
+            if (token.is('}')) {
+                depth--;
+                while (!openNamespaces.empty() && openNamespaces.back().first > depth) {
+                    classInfo.namespaces.resize(classInfo.namespaces.size() - openNamespaces.back().second);
+                    openNamespaces.pop_back();
+                }
+                continue;
             }
-
-            // Atualiza modificador de acesso atual
-            if (AccessSpecifier spec = currentAccessFromLine(cleanLine); spec != AccessSpecifier::None) {
-                currentAccess = spec;
-                nextFieldIsTransient = false;
+            if (token.is("namespace")) {
+                // namespace a::b { ... }, inline namespace v1 { ... }; alias e "using namespace" não abrem escopo
+                std::vector<std::string> names;
+                while (lexer.peek().isIdentifier() || lexer.peek().is("::")) {
+                    const Token part = lexer.next();
+                    if (part.isIdentifier() && !part.is("inline")) names.emplace_back(part.text);
+                }
+                if (lexer.peek().is('{')) {
+                    lexer.next();
+                    depth++;
+                    openNamespaces.emplace_back(depth, names.size());
+                    classInfo.namespaces.insert(classInfo.namespaces.end(), names.begin(), names.end());
+                }
                 continue;
             }
-
-            // Se linha vazia, pular
-            if (cleanLine.empty()) {
+            if (!token.is(SERIALIZABLE_MACRO) || !lexer.peek().is('(')) {
                 continue;
             }
 
-            bool currentLineHasTransient = containsTransient(cleanLine);
+            // Extrai nome da classe: SERIALIZABLE(Usuario)
+            lexer.next();
+            const Token* previous = nullptr;
+            Token part;
+            while (!lexer.peek().isEnd() && !lexer.peek().is(')')) {
+                part = lexer.next();
+                Lexer::appendSpelling(classInfo.name, previous, part);
+                previous = &part;
+            }
+            lexer.next();
 
-            // Tentar parsear como campo
-            // Campos terminam com ; e não têm parênteses (não são métodos)
-            if (cleanLine.find(';') != std::string::npos &&
-                cleanLine.find('(') == std::string::npos &&
-                cleanLine.find(')') == std::string::npos) {
+            if (!classInfo.name.empty()) break;
+        }
+        classInfo.qualifiedName = classInfo.getNamespacedName();
 
-                bool isTransientField = currentLineHasTransient || nextFieldIsTransient;
+        AccessSpecifier currentAccess = AccessSpecifier::Private; // class padrão é private
 
-                if (auto typeAndName = extractTypeAndName(cleanLine)) {
-                    FieldInfo field;
-                    field.type = typeAndName->first;
-                    field.name = typeAndName->second;
-                    field.access = currentAccess;
-                    field.isTransient = isTransientField;
+        // A declaração da classe costuma vir logo depois da macro, na mesma linha ou não
+        if (lexer.peek().is("template")) {
+            lexer.next();
+            if (lexer.next().is('<')) skipGroup(lexer, '<', '>');
+        }
+        if (lexer.peek().is("class") || lexer.peek().is("struct")) {
+            if (lexer.next().is("struct")) {
+                classInfo.isStruct = true;
+                currentAccess = AccessSpecifier::Public; // structs são public por padrão
+            }
 
-                    classInfo.fields.push_back(field);
-                }
-                nextFieldIsTransient = false;
-            } else {
-                if (cleanLine == "TRANSIENT") {
-                    nextFieldIsTransient = true;
-                } else {
-                    nextFieldIsTransient = false;
+            // Nome, final e classes base até a chave de abertura
+            while (!lexer.peek().isEnd() && !lexer.peek().is('{')) {
+                if (lexer.next().is(';')) {
+                    return classInfo;   // Só uma declaração antecipada
                 }
             }
+            lexer.next();
         }
+        // Sem class/struct em seguida: a macro está dentro do corpo da classe
+        classInfo.bodyBegin = lexer.offset();
+
+        // Buffers reaproveitados entre declarações: nenhuma alocação por token
+        std::vector<Token> declaration;
+        std::vector<Token> cleaned;
+        declaration.reserve(32);
+        cleaned.reserve(32);
+
+        while (!lexer.peek().isEnd() && !lexer.peek().is('}')) {
+            if (lexer.peek().is(';')) {
+                lexer.next();
+                continue;
+            }
 
-        if (!foundSerializable) {
-            return std::nullopt;
-        }
-
-        return classInfo;
-    }
-
-    AccessSpecifier Parser::currentAccessFromLine(const std::string& line) const {
-        std::string trimmed = Utils::trim(line);
-
-        if (trimmed == "public:") {
-            return AccessSpecifier::Public;
-        }
+            // Atualiza modificador de acesso atual
+            if (const AccessSpecifier spec = accessFromKeyword(lexer.peek()); spec != AccessSpecifier::None) {
+                lexer.next();
+                if (lexer.peek().is(':')) {
+                    lexer.next();
+                    currentAccess = spec;
+                }
+                continue;
+            }
 
-        if (trimmed == "private:") {
-            return AccessSpecifier::Private;
+            if (readDeclaration(lexer, declaration) == DeclarationKind::Data) {
+                extractFields(declaration, cleaned, currentAccess, classInfo.fields);
+            }
         }
 
-        if (trimmed == "protected:") {
-            return AccessSpecifier::Protected;
+        if (lexer.peek().is('}')) {
+            classInfo.bodyEnd = static_cast<size_t>(lexer.peek().text.data() - content.data());
         }
 
-        return AccessSpecifier::None;
+        return classInfo;
     }
 }
 
@@ -242,14 +445,26 @@ std::optional<serializer::ClassInfo> serializer::Parser::parseClassWithDependenc
     auto classInfo = parseClass(filePath);
     if (!classInfo) return std::nullopt;
 
+    analyzeDependencies(*classInfo, typeChecker);
+    return classInfo;
+}
+
+void serializer::Parser::analyzeDependencies(
+    serializer::ClassInfo& classInfo,
+    const serializer::TypeChecker& typeChecker
+) const {
+    // Recalcula do zero: no --watch a mesma classe é analisada de novo após mudanças
+    classInfo.dependencies.clear();
+
     // Analisa tipos dos campos
-    for (const auto& field : classInfo->fields) {
+    for (const auto& field : classInfo.fields) {
         auto analysis = typeChecker.analyzeType(field.type);
 
         // Se campo é classe serializável, precisamos gerar serialização dela também
         if (analysis.category == TypeChecker::TypeCategory::Serializable) {
-            // Marca que essa classe depende de outra
-            classInfo->dependencies.insert(analysis.baseType);
+            // Marca que essa classe depende de outra. A auto-referência fica no grafo: é ela que
+            // marca a classe como recursiva; orderClasses e os includes ignoram a própria classe
+            classInfo.dependencies.insert(analysis.baseType);
         }
 
         // Se campo é container de classes serializáveis
@@ -257,11 +472,9 @@ std::optional<serializer::ClassInfo> serializer::Parser::parseClassWithDependenc
             for (const auto& templateArg : analysis.templateArgs) {
                 auto argAnalysis = typeChecker.analyzeType(templateArg);
                 if (argAnalysis.category == TypeChecker::TypeCategory::Serializable) {
-                    classInfo->dependencies.insert(argAnalysis.baseType);
+                    classInfo.dependencies.insert(argAnalysis.baseType);
                 }
             }
         }
     }
-
-    return classInfo;
-}
\ No newline at end of file
+}
@@ -0,0 +1,155 @@
+//
+// Created by bruno on 16/10/2026.
+//
+#include <iomanip>
+
+#include "include/JsonWriter.h"
+#include "include/Profiler.h"
+
+namespace serializer {
+    namespace {
+        // Fases medidas como soma do tempo das threads (não entram no total)
+        bool isThreadTime(Profiler::Phase phase) {
+            return phase == Profiler::Phase::Read || phase == Profiler::Phase::Scan ||
+                   phase == Profiler::Phase::Parse;
+        }
+
+        template<typename E>
+        constexpr E at(size_t i) { return static_cast<E>(i); }
+    }
+
+    const char* Profiler::name(Phase phase) {
+        switch (phase) {
+            case Phase::Walk: return "walk";
+            case Phase::Headers: return "headers";
+            case Phase::Read: return "read";
+            case Phase::Scan: return "scan";
+            case Phase::Parse: return "parse";
+            case Phase::Register: return "register";
+            case Phase::Dependencies: return "dependencies";
+            case Phase::Sort: return "sort";
+            case Phase::Generate: return "generate";
+            case Phase::Cache: return "cache";
+            case Phase::Count: break;
+        }
+        return "?";
+    }
+
+    const char* Profiler::name(Counter counter) {
+        switch (counter) {
+            case Counter::EntriesVisited: return "entries_visited";
+            case Counter::DirectoriesSkipped: return "directories_skipped";
+            case Counter::HeadersFound: return "headers_found";
+            case Counter::HeadersFromCache: return "headers_from_cache";
+            case Counter::BytesRead: return "bytes_read";
+            case Counter::ClassesParsed: return "classes_parsed";
+            case Counter::AnalyzeTypeCalls: return "analyze_type_calls";
+            case Counter::AnalyzeTypeCacheHits: return "analyze_type_cache_hits";
+            case Counter::FilesWritten: return "files_written";
+            case Counter::FilesUnchanged: return "files_unchanged";
+            case Counter::BytesWritten: return "bytes_written";
+            case Counter::Count: break;
+        }
+        return "?";
+    }
+
+    void Profiler::reset() {
+        for (auto& phase : phases_) phase.store(0, std::memory_order_relaxed);
+        for (auto& counter : counters_) counter.store(0, std::memory_order_relaxed);
+    }
+
+    double Profiler::milliseconds(Phase phase) const {
+        const Clock::duration elapsed(phases_[index(phase)].load(std::memory_order_relaxed));
+        return std::chrono::duration<double, std::milli>(elapsed).count();
+    }
+
+    void Profiler::report(std::ostream& out) const {
+        if (format_ == ProfileFormat::Json) {
+            out << toJson() << "\n";
+        } else if (format_ == ProfileFormat::Table) {
+            reportTable(out);
+        }
+    }
+
+    std::string Profiler::toJson() const {
+        std::string buffer;
+        JsonWriter out(buffer);
+
+        double total = 0;
+        out.beginObject();
+        out.key("phases_ms");
+        out.beginObject();
+        for (size_t i = 0; i < phases_.size(); ++i) {
+            const auto phase = at<Phase>(i);
+            if (isThreadTime(phase)) continue;
+            out.key(name(phase));
+            out.value(milliseconds(phase));
+            total += milliseconds(phase);
+        }
+        out.endObject();
+
+        out.key("thread_time_ms");
+        out.beginObject();
+        for (size_t i = 0; i < phases_.size(); ++i) {
+            const auto phase = at<Phase>(i);
+            if (!isThreadTime(phase)) continue;
+            out.key(name(phase));
+            out.value(milliseconds(phase));
+        }
+        out.endObject();
+
+        out.key("total_ms");
+        out.value(total);
+
+        out.key("counters");
+        out.beginObject();
+        for (size_t i = 0; i < counters_.size(); ++i) {
+            out.key(name(at<Counter>(i)));
+            out.value(counters_[i].load(std::memory_order_relaxed));
+        }
+        out.endObject();
+        out.endObject();
+
+        return buffer;
+    }
+
+    void Profiler::reportTable(std::ostream& out) const {
+        double total = 0;
+        for (size_t i = 0; i < phases_.size(); ++i) {
+            if (!isThreadTime(at<Phase>(i))) total += milliseconds(at<Phase>(i));
+        }
+
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+        out << std::fixed;
+
+        out << "\n⏱️  Perfil da execução\n";
+        out << "   " << std::left << std::setw(22) << "Fase" << std::right << std::setw(12) << "ms"
+            << std::setw(9) << "%" << "\n";
+        for (size_t i = 0; i < phases_.size(); ++i) {
+            const auto phase = at<Phase>(i);
+            const double ms = milliseconds(phase);
+            if (isThreadTime(phase)) {
+                // Subfases de "headers": soma das threads, sem porcentagem
+                out << "     " << std::left << std::setw(20) << (std::string(name(phase)) + " *")
+                    << std::right << std::setw(12) << std::setprecision(3) << ms << "\n";
+                continue;
+            }
+            out << "   " << std::left << std::setw(22) << name(phase) << std::right << std::setw(12)
+                << std::setprecision(3) << ms << std::setw(8) << std::setprecision(1)
+                << (total > 0 ? 100.0 * ms / total : 0.0) << "%\n";
+        }
+        out << "   " << std::left << std::setw(22) << "total" << std::right << std::setw(12)
+            << std::setprecision(3) << total << "\n";
+        out << "   * soma do tempo de todas as threads\n\n";
+
+        out << "   " << std::left << std::setw(26) << "Contador" << std::right << std::setw(16) << "Valor" << "\n";
+        for (size_t i = 0; i < counters_.size(); ++i) {
+            out << "   " << std::left << std::setw(26) << name(at<Counter>(i)) << std::right << std::setw(16)
+                << counters_[i].load(std::memory_order_relaxed) << "\n";
+        }
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+}
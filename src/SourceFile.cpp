@@ -0,0 +1,111 @@
+//
+// Created by bruno on 16/10/2026.
+//
+#include <fstream>
+#include <utility>
+
+#include "include/SourceFile.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CPP_SERIALIZER_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace serializer {
+    namespace {
+        // Abaixo disso um read() simples custa menos que mmap + munmap
+        constexpr size_t MMAP_THRESHOLD = 64 * 1024;
+    }
+
+    std::optional<SourceFile> SourceFile::open(const std::filesystem::path& filePath) {
+        SourceFile file;
+        file.path_ = filePath;
+
+#ifdef CPP_SERIALIZER_HAS_MMAP
+        const int fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return std::nullopt;
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            return std::nullopt;
+        }
+
+        const auto size = static_cast<size_t>(info.st_size);
+        if (size >= MMAP_THRESHOLD) {
+            void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED) {
+                // Parser varre do início ao fim: pede read-ahead agressivo
+                ::madvise(mapped, size, MADV_SEQUENTIAL);
+                ::close(fd);
+                file.mapped_ = static_cast<const char*>(mapped);
+                file.mappedSize_ = size;
+                return file;
+            }
+        }
+
+        // Arquivo pequeno (ou mmap falhou): um único read para o buffer
+        file.buffer_.resize(size);
+        size_t done = 0;
+        while (done < size) {
+            const ssize_t got = ::read(fd, file.buffer_.data() + done, size - done);
+            if (got < 0) {
+                ::close(fd);
+                return std::nullopt;
+            }
+            if (got == 0) break;   // Encolheu enquanto líamos
+            done += static_cast<size_t>(got);
+        }
+        file.buffer_.resize(done);
+        ::close(fd);
+#else
+        std::ifstream stream(filePath, std::ios::binary | std::ios::ate);
+        if (!stream.is_open()) {
+            return std::nullopt;
+        }
+        const auto size = static_cast<size_t>(stream.tellg());
+        stream.seekg(0);
+        file.buffer_.resize(size);
+        stream.read(file.buffer_.data(), static_cast<std::streamsize>(size));
+        file.buffer_.resize(static_cast<size_t>(stream.gcount()));
+#endif
+
+        return file;
+    }
+
+    SourceFile::SourceFile(SourceFile&& other) noexcept
+        : path_(std::move(other.path_)),
+          buffer_(std::move(other.buffer_)),
+          mapped_(std::exchange(other.mapped_, nullptr)),
+          mappedSize_(std::exchange(other.mappedSize_, 0)) {}
+
+    SourceFile& SourceFile::operator=(SourceFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            path_ = std::move(other.path_);
+            buffer_ = std::move(other.buffer_);
+            mapped_ = std::exchange(other.mapped_, nullptr);
+            mappedSize_ = std::exchange(other.mappedSize_, 0);
+        }
+        return *this;
+    }
+
+    SourceFile::~SourceFile() {
+        release();
+    }
+
+    void SourceFile::release() {
+#ifdef CPP_SERIALIZER_HAS_MMAP
+        if (mapped_) {
+            ::munmap(const_cast<char*>(mapped_), mappedSize_);
+        }
+#endif
+        mapped_ = nullptr;
+        mappedSize_ = 0;
+    }
+}
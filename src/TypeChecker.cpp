@@ -1,10 +1,37 @@
 // TypeChecker.cpp - implementação
 #include "include/TypeChecker.h"
+#include "include/Lexer.h"
 #include "include/Utils.h"
 #include <algorithm>
+#include <array>
+#include <mutex>
 #include <stack>
+#include <string_view>
 
 namespace serializer {
+    namespace {
+        // Remove const, volatile e mutable (tokens inteiros, em qualquer nível) e
+        // normaliza o espaçamento, como o Parser faz com o tipo dos campos
+        std::string normalizeType(const std::string& typeName) {
+            std::string cleaned;
+            cleaned.reserve(typeName.size());
+
+            Lexer lexer(typeName);
+            Token previous;
+            bool hasPrevious = false;
+            for (Token token = lexer.next(); !token.isEnd(); token = lexer.next()) {
+                if (token.is("const") || token.is("volatile") || token.is("mutable")) {
+                    continue;
+                }
+                Lexer::appendSpelling(cleaned, hasPrevious ? &previous : nullptr, token);
+                previous = token;
+                hasPrevious = true;
+            }
+
+            return cleaned;
+        }
+    }
+
     TypeChecker::TypeChecker() {
         initializeTypes();
     }
@@ -22,7 +49,7 @@ namespace serializer {
 
         // Tipos STL básicos
         stlTypes_ = {
-            "std::string", "std::string_view",
+            "std::string", "std::string_view", "std::pmr::string",
             "std::byte"
         };
 
@@ -39,29 +66,76 @@ namespace serializer {
             "std::pair<",
             "std::tuple<",
             "std::optional<",
-            "std::variant<"
+            "std::variant<",
+            // Variantes com std::pmr::polymorphic_allocator (modo --pmr)
+            "std::pmr::vector<",
+            "std::pmr::list<",
+            "std::pmr::deque<",
+            "std::pmr::set<",
+            "std::pmr::unordered_set<",
+            "std::pmr::map<",
+            "std::pmr::unordered_map<"
         };
     }
 
     void TypeChecker::registerSerializableClass(const ClassInfo& classInfo) {
         serializableClasses_.insert(classInfo.name);
-        classRegistry_[classInfo.name] = classInfo;
+        invalidateAnalysis();
+    }
+
+    void TypeChecker::unregisterSerializableClass(const std::string& className) {
+        serializableClasses_.erase(className);
+        invalidateAnalysis();
+    }
+
+    void TypeChecker::invalidateAnalysis() {
+        // Um tipo pode virar (ou deixar de ser) Serializable: tudo precisa ser refeito
+        std::unique_lock lock(analysisMutex_);
+        analysisCache_.clear();
+        recursiveClasses_.clear();
     }
 
     TypeChecker::TypeAnalysis TypeChecker::analyzeType(const std::string& typeName) const {
+        const std::string cleaned = normalizeType(typeName);
+        analyzeCalls_.fetch_add(1, std::memory_order_relaxed);
+
         TypeAnalysis analysis;
-        std::string cleaned = typeName;
-
-        // Remove const, volatile, etc
-        std::vector<std::string> qualifiers = {"const", "volatile", "mutable"};
-        for (const auto& q : qualifiers) {
-            size_t pos = cleaned.find(q);
-            if (pos != std::string::npos) {
-                cleaned.erase(pos, q.length());
+        bool cached = false;
+        {
+            std::shared_lock lock(analysisMutex_);
+            if (auto it = analysisCache_.find(cleaned); it != analysisCache_.end()) {
+                analysis = it->second;
+                cached = true;
             }
         }
+        if (cached) {
+            analyzeHits_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (!cached) {
+            // Calcula fora do lock: argumentos de template passam por analyzeType de novo
+            analysis = computeAnalysis(cleaned);
+            std::unique_lock lock(analysisMutex_);
+            analysisCache_.try_emplace(cleaned, analysis);
+        }
+
+        // Verifica recursão (se essa classe contém a si mesma, direta ou indiretamente)
+        analysis.isRecursive = analysis.category == TypeCategory::Serializable &&
+                               recursiveClasses_.count(analysis.baseType) > 0;
+        return analysis;
+    }
 
-        cleaned = Utils::trim(cleaned);
+    TypeChecker::Stats TypeChecker::stats() const {
+        return {analyzeCalls_.load(std::memory_order_relaxed), analyzeHits_.load(std::memory_order_relaxed)};
+    }
+
+    void TypeChecker::resetStats() {
+        analyzeCalls_.store(0, std::memory_order_relaxed);
+        analyzeHits_.store(0, std::memory_order_relaxed);
+    }
+
+    TypeChecker::TypeAnalysis TypeChecker::computeAnalysis(const std::string& cleaned) const {
+        TypeAnalysis analysis;
 
         // Verifica se é tipo primitivo
         if (primitiveTypes_.count(cleaned)) {
@@ -71,7 +145,8 @@ namespace serializer {
         }
 
         // Verifica se é string
-        if (cleaned == "std::string" || cleaned == "std::string_view") {
+        if (cleaned == "std::string" || cleaned == "std::string_view" ||
+            cleaned == "std::pmr::string") {
             analysis.category = TypeCategory::String;
             analysis.baseType = cleaned;
             return analysis;
@@ -84,7 +159,10 @@ namespace serializer {
             "std::vector", "std::list", "std::deque", "std::array",
             "std::set", "std::unordered_set", "std::multiset",
             "std::map", "std::unordered_map", "std::multimap",
-            "std::pair", "std::tuple", "std::optional", "std::variant"
+            "std::pair", "std::tuple", "std::optional", "std::variant",
+            "std::pmr::vector", "std::pmr::list", "std::pmr::deque",
+            "std::pmr::set", "std::pmr::unordered_set", "std::pmr::multiset",
+            "std::pmr::map", "std::pmr::unordered_map", "std::pmr::multimap"
         };
 
         if (containerBases.count(base)) {
@@ -108,12 +186,6 @@ namespace serializer {
         if (serializableClasses_.count(cleaned)) {
             analysis.category = TypeCategory::Serializable;
             analysis.baseType = cleaned;
-
-            // Verifica recursão (se essa classe contém a si mesma)
-            if (hasCircularDependency(cleaned)) {
-                analysis.isRecursive = true;
-            }
-
             return analysis;
         }
 
@@ -132,47 +204,113 @@ namespace serializer {
         return analysis;
     }
 
-    bool TypeChecker::hasCircularDependency(const std::string& className,
-                                           int maxDepth) const {
-        if (maxDepth <= 0) return false;
+    bool TypeChecker::hasCircularDependency(const std::string& className) const {
+        return recursiveClasses_.count(className) > 0;
+    }
 
-        auto it = classRegistry_.find(className);
-        if (it == classRegistry_.end()) return false;
+    void TypeChecker::analyzeClassGraph(ClassTable& classes) {
+        const std::vector<ClassId>& ids = classes.ids();
+        const size_t count = ids.size();
 
-        const ClassInfo& classInfo = it->second;
+        // Arestas por posição em ids(): classe -> dependências que também estão na tabela
+        std::unordered_map<ClassId, size_t> indexOf;
+        for (size_t i = 0; i < count; ++i) {
+            indexOf.emplace(ids[i], i);
+        }
+        std::vector<std::vector<size_t>> edges(count);
+        for (size_t i = 0; i < count; ++i) {
+            for (const auto& dep : classes[ids[i]].dependencies) {
+                if (auto it = indexOf.find(classes.find(dep)); it != indexOf.end()) {
+                    edges[i].push_back(it->second);
+                }
+            }
+        }
 
-        // Verifica se algum campo é do mesmo tipo (auto-referência direta)
-        for (const auto& field : classInfo.fields) {
-            TypeAnalysis fieldAnalysis = analyzeType(field.type);
+        // Tarjan iterativo (sem recursão: grafos grandes não estouram a pilha).
+        // As componentes saem em ordem topológica reversa: dependências primeiro.
+        constexpr size_t UNVISITED = static_cast<size_t>(-1);
+        std::vector<size_t> index(count, UNVISITED);
+        std::vector<size_t> low(count, 0);
+        std::vector<char> onStack(count, 0);
+        std::vector<size_t> component(count, 0);
+        std::vector<std::vector<size_t>> components;
+        std::vector<size_t> stack;
+        size_t counter = 0;
 
-            if (fieldAnalysis.baseType == className) {
-                return true; // Auto-referência direta
-            }
+        struct Frame {
+            size_t node;
+            size_t nextEdge;
+        };
+        std::vector<Frame> calls;
 
-            // Verifica recursão em containers
-            if (fieldAnalysis.category == TypeCategory::Container) {
-                for (const auto& templateArg : fieldAnalysis.templateArgs) {
-                    if (templateArg == className) {
-                        return true; // Container do mesmo tipo
-                    }
+        const auto visit = [&](size_t node) {
+            index[node] = low[node] = counter++;
+            stack.push_back(node);
+            onStack[node] = 1;
+            calls.push_back({node, 0});
+        };
 
-                    // Verifica recursão indireta
-                    if (hasCircularDependency(templateArg, maxDepth - 1)) {
-                        return true;
+        for (size_t start = 0; start < count; ++start) {
+            if (index[start] != UNVISITED) continue;
+            visit(start);
+
+            while (!calls.empty()) {
+                const size_t node = calls.back().node;
+                if (calls.back().nextEdge < edges[node].size()) {
+                    const size_t next = edges[node][calls.back().nextEdge++];
+                    if (index[next] == UNVISITED) {
+                        visit(next);
+                    } else if (onStack[next]) {
+                        low[node] = std::min(low[node], index[next]);
                     }
+                    continue;
                 }
-            }
 
-            // Verifica recursão indireta
-            if (fieldAnalysis.category == TypeCategory::Serializable &&
-                fieldAnalysis.baseType != className) {
+                calls.pop_back();
+                if (!calls.empty()) {
+                    const size_t parent = calls.back().node;
+                    low[parent] = std::min(low[parent], low[node]);
+                }
 
-                if (hasCircularDependency(fieldAnalysis.baseType, maxDepth - 1)) {
-                    return true;
+                if (low[node] == index[node]) {
+                    std::vector<size_t> members;
+                    size_t member;
+                    do {
+                        member = stack.back();
+                        stack.pop_back();
+                        onStack[member] = 0;
+                        component[member] = components.size();
+                        members.push_back(member);
+                    } while (member != node);
+                    components.push_back(std::move(members));
                 }
             }
         }
 
-        return false;
+        // Profundidade por componente, das folhas para cima
+        std::vector<int> depth(components.size(), 0);
+        recursiveClasses_.clear();
+
+        for (size_t c = 0; c < components.size(); ++c) {
+            bool cyclic = components[c].size() > 1;
+            for (const size_t member : components[c]) {
+                for (const size_t next : edges[member]) {
+                    if (component[next] == c) {
+                        cyclic = true;   // Ciclo (ou auto-referência)
+                    } else {
+                        depth[c] = std::max(depth[c], depth[component[next]] + 1);
+                    }
+                }
+            }
+
+            for (const size_t member : components[c]) {
+                ClassInfo& classInfo = classes[ids[member]];
+                classInfo.hasCircularDependency = cyclic;
+                classInfo.maxNestingDepth = depth[c];
+                if (cyclic) {
+                    recursiveClasses_.insert(classInfo.name);
+                }
+            }
+        }
     }
-}
\ No newline at end of file
+}
@@ -5,57 +5,44 @@
 #include "include/Utils.h"
 
 namespace serializer {
-    std::string Utils::trim(const std::string& str) {
+    std::string_view Utils::trim(std::string_view str) {
         auto start = str.find_first_not_of(" \t");
-        if (start == std::string::npos) return "";
+        if (start == std::string_view::npos) return {};
 
         auto end = str.find_last_not_of(" \t");
         return str.substr(start, end - start + 1);
     }
 
-    std::string Utils::removeComments(std::string line) {
-        size_t commentPos = line.find("//");
-        if (commentPos != std::string::npos) {
-            line = line.substr(0, commentPos);
-        }
-        return trim(line);
-    }
-
-    std::pair<std::string, std::vector<std::string>> Utils::extractTemplateInfo(const std::string& typeName) {
-        std::string baseType = typeName;
+    std::pair<std::string, std::vector<std::string>> Utils::extractTemplateInfo(std::string_view typeName) {
         std::vector<std::string> templateArgs;
 
         size_t templateStart = typeName.find('<');
-        if (templateStart != std::string::npos && typeName.back() == '>') {
-            baseType = typeName.substr(0, templateStart);
-
-            std::string argsStr = typeName.substr(templateStart + 1,
-                                                 typeName.length() - templateStart - 2);
-
-            // Parsing simples de template args
-            int bracketCount = 0;
-            std::string currentArg;
-
-            for (char c : argsStr) {
-                if (c == '<') {
-                    bracketCount++;
-                    currentArg += c;
-                } else if (c == '>') {
-                    bracketCount--;
-                    currentArg += c;
-                } else if (c == ',' && bracketCount == 0) {
-                    templateArgs.push_back(trim(currentArg));
-                    currentArg.clear();
-                } else {
-                    currentArg += c;
-                }
-            }
+        if (templateStart == std::string_view::npos || typeName.back() != '>') {
+            return {std::string(typeName), templateArgs};
+        }
 
-            if (!currentArg.empty()) {
-                templateArgs.push_back(trim(currentArg));
+        const std::string_view argsStr = typeName.substr(templateStart + 1,
+                                                         typeName.length() - templateStart - 2);
+
+        // Divide nas vírgulas de nível zero; cada argumento é uma view, copiada uma única vez
+        int bracketCount = 0;
+        size_t argStart = 0;
+        for (size_t i = 0; i < argsStr.size(); ++i) {
+            const char c = argsStr[i];
+            if (c == '<' || c == '(') {
+                bracketCount++;
+            } else if (c == '>' || c == ')') {
+                bracketCount--;
+            } else if (c == ',' && bracketCount == 0) {
+                templateArgs.emplace_back(trim(argsStr.substr(argStart, i - argStart)));
+                argStart = i + 1;
             }
         }
 
-        return {baseType, templateArgs};
+        if (argStart < argsStr.size()) {
+            templateArgs.emplace_back(trim(argsStr.substr(argStart)));
+        }
+
+        return {std::string(typeName.substr(0, templateStart)), templateArgs};
     }
-}
+}
\ No newline at end of file
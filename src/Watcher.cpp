@@ -0,0 +1,153 @@
+//
+// Created by bruno on 16/10/2026.
+//
+#include <algorithm>
+#include <iostream>
+#include <set>
+
+#include "include/Watcher.h"
+
+#ifdef __linux__
+#define CPP_SERIALIZER_HAS_INOTIFY 1
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace serializer {
+    namespace {
+        // Silêncio necessário para considerar uma rajada de eventos encerrada
+        constexpr int DEBOUNCE_MS = 150;
+
+#ifdef CPP_SERIALIZER_HAS_INOTIFY
+        constexpr uint32_t WATCH_MASK = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM |
+                                        IN_MOVED_TO | IN_DELETE_SELF | IN_ONLYDIR;
+#endif
+    }
+
+    Watcher::Watcher(fs::path root, WalkOptions options)
+        : root_(std::move(root)), options_(std::move(options)) {
+        options_.compileCommands.reset();
+    }
+
+    Watcher::~Watcher() {
+#ifdef CPP_SERIALIZER_HAS_INOTIFY
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+#endif
+    }
+
+    bool Watcher::start() {
+#ifdef CPP_SERIALIZER_HAS_INOTIFY
+        fd_ = ::inotify_init1(IN_CLOEXEC);
+        if (fd_ < 0) {
+            std::cerr << "❌ inotify indisponível: " << std::strerror(errno) << "\n";
+            return false;
+        }
+        watchTree(fs::path());
+        return !directories_.empty();
+#else
+        std::cerr << "❌ --watch só é suportado no Linux (inotify)\n";
+        return false;
+#endif
+    }
+
+    void Watcher::watchTree(const fs::path& dir, std::vector<fs::path>* headers) {
+#ifdef CPP_SERIALIZER_HAS_INOTIFY
+        for (const auto& directory : FileWalker::findDirectories(root_, options_, dir, headers)) {
+            const int wd = ::inotify_add_watch(fd_, directory.c_str(), WATCH_MASK);
+            if (wd < 0) {
+                if (errno == ENOSPC) {
+                    std::cerr << "⚠️  Limite de watches do inotify atingido "
+                                 "(fs.inotify.max_user_watches), parte do projeto não será observada\n";
+                    return;
+                }
+                continue;
+            }
+            directories_[wd] = directory;
+        }
+#else
+        (void)dir;
+        (void)headers;
+#endif
+    }
+
+    std::vector<fs::path> Watcher::waitForChanges() {
+        std::set<fs::path> changed;
+
+#ifdef CPP_SERIALIZER_HAS_INOTIFY
+        bool rescan = false;
+        int timeout = -1;   // Espera o primeiro evento sem limite
+        alignas(inotify_event) char buffer[64 * 1024];
+
+        while (true) {
+            pollfd pfd{fd_, POLLIN, 0};
+            const int ready = ::poll(&pfd, 1, timeout);
+            if (ready < 0) {
+                if (errno == EINTR) continue;
+                break;
+            }
+            if (ready == 0) {
+                if (!changed.empty() || rescan) break;   // Rajada terminou
+                continue;
+            }
+
+            const ssize_t length = ::read(fd_, buffer, sizeof(buffer));
+            if (length <= 0) {
+                if (length < 0 && errno == EINTR) continue;
+                break;
+            }
+
+            for (const char* p = buffer; p < buffer + length;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(p);
+                p += sizeof(inotify_event) + event->len;
+
+                if (event->mask & IN_Q_OVERFLOW) {
+                    rescan = true;   // Eventos perdidos: só uma nova varredura é confiável
+                    continue;
+                }
+
+                const auto dir = directories_.find(event->wd);
+                if (dir == directories_.end()) continue;
+                if (event->mask & IN_IGNORED) {
+                    directories_.erase(dir);
+                    continue;
+                }
+                if (event->len == 0) continue;
+
+                const fs::path path = dir->second / event->name;
+                if (event->mask & IN_ISDIR) {
+                    if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                        // Diretório novo (ou movido para dentro): observa e trata seus headers como novos
+                        std::vector<fs::path> headers;
+                        watchTree(path, &headers);
+                        changed.insert(headers.begin(), headers.end());
+                    } else if (event->mask & IN_MOVED_FROM) {
+                        rescan = true;   // Headers saíram junto, sem eventos próprios
+                    }
+                    continue;
+                }
+
+                if (FileWalker::isHeaderFile(path)) {
+                    changed.insert(path);
+                }
+            }
+
+            timeout = DEBOUNCE_MS;
+        }
+
+        if (rescan) {
+            for (auto& header : FileWalker::findHeaderFiles(root_, options_)) {
+                changed.insert(std::move(header));
+            }
+        }
+#endif
+
+        return {changed.begin(), changed.end()};
+    }
+}
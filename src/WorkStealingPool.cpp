@@ -0,0 +1,100 @@
+//
+// Created by bruno on 16/10/2026.
+//
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "include/WorkStealingPool.h"
+
+namespace serializer {
+    namespace {
+        // Fila de uma thread: a dona consome pela frente, ladrões pelo fundo
+        struct TaskQueue {
+            std::mutex mutex;
+            std::deque<size_t> tasks;
+
+            std::optional<size_t> popFront() {
+                std::lock_guard lock(mutex);
+                if (tasks.empty()) return std::nullopt;
+                const size_t task = tasks.front();
+                tasks.pop_front();
+                return task;
+            }
+
+            std::optional<size_t> stealBack() {
+                std::lock_guard lock(mutex);
+                if (tasks.empty()) return std::nullopt;
+                const size_t task = tasks.back();
+                tasks.pop_back();
+                return task;
+            }
+        };
+    }
+
+    void WorkStealingPool::parallelFor(size_t count, const std::function<void(size_t)>& task) const {
+        const size_t workers = std::min<size_t>(jobs_, count);
+        if (workers <= 1) {
+            for (size_t i = 0; i < count; ++i) {
+                task(i);
+            }
+            return;
+        }
+
+        // Blocos contíguos: cada thread começa por arquivos vizinhos no disco
+        std::vector<std::unique_ptr<TaskQueue>> queues;
+        queues.reserve(workers);
+        for (size_t w = 0; w < workers; ++w) {
+            auto queue = std::make_unique<TaskQueue>();
+            const size_t begin = count * w / workers;
+            const size_t end = count * (w + 1) / workers;
+            for (size_t i = begin; i < end; ++i) {
+                queue->tasks.push_back(i);
+            }
+            queues.push_back(std::move(queue));
+        }
+
+        std::atomic<bool> failed = false;
+        std::exception_ptr firstError;
+        std::mutex errorMutex;
+
+        auto worker = [&](size_t self) {
+            // Nenhuma tarefa gera outras: quando todas as filas estão vazias, acabou
+            while (!failed.load(std::memory_order_relaxed)) {
+                std::optional<size_t> next = queues[self]->popFront();
+                for (size_t offset = 1; !next && offset < workers; ++offset) {
+                    next = queues[(self + offset) % workers]->stealBack();
+                }
+                if (!next) return;
+
+                try {
+                    task(*next);
+                } catch (...) {
+                    std::lock_guard lock(errorMutex);
+                    if (!firstError) firstError = std::current_exception();
+                    failed = true;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        for (size_t w = 1; w < workers; ++w) {
+            threads.emplace_back(worker, w);
+        }
+        worker(0);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        if (firstError) {
+            std::rethrow_exception(firstError);
+        }
+    }
+}
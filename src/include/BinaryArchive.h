@@ -0,0 +1,396 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_BINARYARCHIVE_H
+#define CPP_SERIALIZER_BINARYARCHIVE_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "TypeTraits.h"
+
+/*
+ * Archives binários para os métodos genéricos gerados
+ * (template<typename Archive> serialize/deserialize com "ar & campo").
+ *
+ * Sem dispatch virtual e sem rastreamento de objetos: números vão com um
+ * único memcpy, e containers contíguos deles (std::vector, std::array,
+ * std::string) vão como um bloco só. bool e enums vão campo a campo e são
+ * validados na leitura; structs precisam do próprio serialize(Archive&).
+ *
+ * O layout é o da máquina (endianness e tamanhos nativos): serve para troca
+ * entre processos da mesma arquitetura. Para um formato portável use o
+ * serializeBinary gerado (WireFormat.h).
+ */
+namespace serializer {
+    class BinaryInputArchive;
+
+    namespace detail {
+        template<typename T, typename Archive>
+        concept HasArchiveSave = requires(const T& obj, Archive& ar) {
+            obj.serialize(ar);
+        };
+
+        template<typename T>
+        concept HasArchiveLoad = requires(T& obj, BinaryInputArchive& ar) {
+            obj.deserialize(ar);
+        };
+
+        // Copiável byte a byte: só números (sem bool) e arrays deles. "Trivialmente copiável" não basta:
+        // string_view e structs com ponteiros crus também são, e os endereços não valem em outro processo
+        template<typename T>
+        struct IsRawNumeric : std::bool_constant<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>> {};
+        template<typename T, size_t N>
+        struct IsRawNumeric<T[N]> : IsRawNumeric<T> {};
+        template<typename T, size_t N>
+        struct IsRawNumeric<std::array<T, N>> : IsRawNumeric<T> {};
+
+        template<typename T>
+        concept Memcpyable = IsRawNumeric<T>::value;
+
+        template<typename T>
+        concept ContiguousMemcpyable = std::ranges::contiguous_range<T> &&
+                                       Memcpyable<std::ranges::range_value_t<T>>;
+    }
+
+    class ArchiveError : public std::runtime_error {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * Buffer de saída explícito para os archives.
+     *
+     * Com reserve(n) (ou o construtor com capacidade) feito para o tamanho da
+     * mensagem, a escrita nunca realoca no meio. Em modo fixo (memória externa)
+     * estourar a capacidade lança ArchiveError em vez de realocar.
+     */
+    class ArchiveBuffer {
+    public:
+        ArchiveBuffer() = default;
+
+        explicit ArchiveBuffer(size_t capacity) {
+            reserve(capacity);
+        }
+
+        // Modo fixo: escreve na memória do chamador, sem nunca alocar
+        ArchiveBuffer(char* external, size_t capacity)
+            : data_(external), capacity_(capacity), fixed_(true) {}
+
+        ArchiveBuffer(const ArchiveBuffer&) = delete;
+        ArchiveBuffer& operator=(const ArchiveBuffer&) = delete;
+
+        // data_ aponta para owned_ (ou para a memória externa): a origem precisa ficar vazia,
+        // senão um append nela escreveria no buffer que agora é do destino
+        ArchiveBuffer(ArchiveBuffer&& other) noexcept
+            : owned_(std::move(other.owned_)), data_(other.data_), size_(other.size_),
+              capacity_(other.capacity_), fixed_(other.fixed_) {
+            other.reset();
+        }
+
+        ArchiveBuffer& operator=(ArchiveBuffer&& other) noexcept {
+            if (this != &other) {
+                owned_ = std::move(other.owned_);
+                data_ = other.data_;
+                size_ = other.size_;
+                capacity_ = other.capacity_;
+                fixed_ = other.fixed_;
+                other.reset();
+            }
+            return *this;
+        }
+
+        // Garante capacidade para `capacity` bytes com uma única alocação
+        void reserve(size_t capacity) {
+            if (capacity <= capacity_) return;
+            if (fixed_) {
+                throw ArchiveError("ArchiveBuffer fixo sem capacidade suficiente");
+            }
+            // make_unique_for_overwrite: não zera a memória que vai ser sobrescrita
+            auto grown = std::make_unique_for_overwrite<char[]>(capacity);
+            if (size_ > 0) {
+                std::memcpy(grown.get(), data_, size_);
+            }
+            owned_ = std::move(grown);
+            data_ = owned_.get();
+            capacity_ = capacity;
+        }
+
+        void append(const void* bytes, size_t size) {
+            if (size > capacity_ - size_) {
+                // Só cresce quando o tamanho não foi informado antes
+                reserve(std::max(size_ + size, capacity_ * 2));
+            }
+            std::memcpy(data_ + size_, bytes, size);
+            size_ += size;
+        }
+
+        void clear() { size_ = 0; }
+
+        [[nodiscard]] const char* data() const { return data_; }
+        [[nodiscard]] size_t size() const { return size_; }
+        [[nodiscard]] size_t capacity() const { return capacity_; }
+        [[nodiscard]] std::string_view view() const { return {data_, size_}; }
+
+    private:
+        void reset() noexcept {
+            owned_.reset();
+            data_ = nullptr;
+            size_ = 0;
+            capacity_ = 0;
+            fixed_ = false;
+        }
+
+        std::unique_ptr<char[]> owned_;
+        char* data_ = nullptr;
+        size_t size_ = 0;
+        size_t capacity_ = 0;
+        bool fixed_ = false;
+    };
+
+    // "Buffer" que só conta bytes: mede o tamanho exato do archive sem escrever
+    class SizeCounter {
+    public:
+        void append(const void*, size_t size) { size_ += size; }
+        [[nodiscard]] size_t size() const { return size_; }
+
+    private:
+        size_t size_ = 0;
+    };
+
+    template<typename Buffer>
+    class BasicOutputArchive {
+    public:
+        explicit BasicOutputArchive(Buffer& buffer) : buffer_(buffer) {}
+
+        template<typename T>
+        BasicOutputArchive& operator&(const T& v) {
+            save(v);
+            return *this;
+        }
+
+        template<typename T>
+        BasicOutputArchive& operator<<(const T& v) {
+            save(v);
+            return *this;
+        }
+
+        template<typename T>
+        void save(const T& v) {
+            using Type = std::remove_cvref_t<T>;
+
+            if constexpr (detail::HasArchiveSave<Type, BasicOutputArchive>) {
+                v.serialize(*this);
+            } else if constexpr (detail::Memcpyable<Type>) {
+                buffer_.append(&v, sizeof(Type));
+            } else if constexpr (std::is_same_v<Type, bool>) {
+                save(static_cast<uint8_t>(v ? 1 : 0));
+            } else if constexpr (std::is_enum_v<Type>) {
+                save(static_cast<std::underlying_type_t<Type>>(v));
+            } else if constexpr (detail::IsOptional<Type>::value ||
+                                 detail::IsSmartPointer<Type>::value) {
+                save(static_cast<uint8_t>(v ? 1 : 0));
+                if (v) save(*v);
+            } else if constexpr (detail::IsPair<Type>::value) {
+                save(v.first);
+                save(v.second);
+            } else if constexpr (detail::IsTuple<Type>::value) {
+                std::apply([this](const auto&... items) { (save(items), ...); }, v);
+            } else if constexpr (detail::IsVariant<Type>::value) {
+                save(static_cast<uint64_t>(v.index()));
+                std::visit([this](const auto& item) { save(item); }, v);
+            } else if constexpr (detail::ContiguousMemcpyable<Type>) {
+                // Bloco contíguo: quantidade + um único memcpy
+                if constexpr (!detail::IsStdArray<Type>::value) {
+                    save(static_cast<uint64_t>(std::ranges::size(v)));
+                }
+                buffer_.append(std::ranges::data(v), std::ranges::size(v) * sizeof(std::ranges::range_value_t<Type>));
+            } else if constexpr (detail::IsStdArray<Type>::value) {
+                for (const auto& item : v) save(item);
+            } else if constexpr (detail::RangeLike<Type>) {
+                save(static_cast<uint64_t>(std::ranges::distance(v)));
+                for (const auto& item : v) save(item);
+            } else {
+                static_assert(detail::AlwaysFalse<Type>, "Tipo não suportado pelo BinaryOutputArchive");
+            }
+        }
+
+        [[nodiscard]] Buffer& buffer() { return buffer_; }
+
+    private:
+        Buffer& buffer_;
+    };
+
+    using BinaryOutputArchive = BasicOutputArchive<ArchiveBuffer>;
+    using BinarySizeArchive = BasicOutputArchive<SizeCounter>;
+
+    // Tamanho exato que BinaryOutputArchive vai escrever para v (para reservar o ArchiveBuffer)
+    template<typename T>
+    [[nodiscard]] size_t archiveSize(const T& v) {
+        SizeCounter counter;
+        BinarySizeArchive ar(counter);
+        ar & v;
+        return counter.size();
+    }
+
+    class BinaryInputArchive {
+    public:
+        explicit BinaryInputArchive(std::string_view input) : input_(input) {}
+
+        template<typename T>
+        BinaryInputArchive& operator&(T& v) {
+            load(v);
+            return *this;
+        }
+
+        template<typename T>
+        BinaryInputArchive& operator>>(T& v) {
+            load(v);
+            return *this;
+        }
+
+        template<typename T>
+        void load(T& v) {
+            using Type = std::remove_cvref_t<T>;
+
+            if constexpr (detail::HasArchiveLoad<Type>) {
+                v.deserialize(*this);
+            } else if constexpr (detail::Memcpyable<Type>) {
+                copyOut(&v, sizeof(Type));
+            } else if constexpr (std::is_same_v<Type, bool>) {
+                // Qualquer byte diferente de 0/1 num bool é UB: valida em vez de copiar
+                uint8_t raw = 0;
+                copyOut(&raw, sizeof(raw));
+                if (raw > 1) {
+                    throw ArchiveError("bool inválido no archive");
+                }
+                v = raw != 0;
+            } else if constexpr (std::is_enum_v<Type>) {
+                std::underlying_type_t<Type> raw{};
+                load(raw);
+                v = static_cast<Type>(raw);
+            } else if constexpr (std::is_same_v<Type, std::string_view>) {
+                static_assert(detail::AlwaysFalse<Type>,
+                              "std::string_view não é dona do texto e não pode ser lida: use std::string");
+            } else if constexpr (detail::IsOptional<Type>::value) {
+                if (loadFlag()) {
+                    if (!v) v.emplace();
+                    load(*v);
+                } else {
+                    v.reset();
+                }
+            } else if constexpr (detail::IsSmartPointer<Type>::value) {
+                if (loadFlag()) {
+                    if (!v) v.reset(new typename Type::element_type());
+                    load(*v);
+                } else {
+                    v.reset();
+                }
+            } else if constexpr (detail::IsPair<Type>::value) {
+                load(v.first);
+                load(v.second);
+            } else if constexpr (detail::IsTuple<Type>::value) {
+                std::apply([this](auto&... items) { (load(items), ...); }, v);
+            } else if constexpr (detail::IsVariant<Type>::value) {
+                const uint64_t index = loadCount();
+                if (index >= std::variant_size_v<Type>) {
+                    throw ArchiveError("índice de variant inválido");
+                }
+                loadVariant(v, index, std::make_index_sequence<std::variant_size_v<Type>>{});
+            } else if constexpr (detail::IsStdArray<Type>::value) {
+                if constexpr (detail::ContiguousMemcpyable<Type>) {
+                    copyOut(v.data(), sizeof(Type));
+                } else {
+                    for (auto& item : v) load(item);
+                }
+            } else if constexpr (detail::ContiguousMemcpyable<Type>) {
+                // std::vector/std::string de triviais: um resize e um memcpy
+                using Element = std::ranges::range_value_t<Type>;
+                const uint64_t count = loadCount();
+                if (count > remaining() / sizeof(Element)) {
+                    throw ArchiveError("archive truncado");
+                }
+                v.resize(count);
+                copyOut(v.data(), count * sizeof(Element));
+            } else if constexpr (detail::MapLike<Type>) {
+                const uint64_t count = loadCount();
+                v.clear();
+                for (uint64_t i = 0; i < count; ++i) {
+                    typename Type::key_type key{};
+                    typename Type::mapped_type item{};
+                    load(key);
+                    load(item);
+                    v.emplace_hint(v.end(), std::move(key), std::move(item));
+                }
+            } else if constexpr (detail::SetLike<Type>) {
+                const uint64_t count = loadCount();
+                v.clear();
+                for (uint64_t i = 0; i < count; ++i) {
+                    typename Type::value_type item{};
+                    load(item);
+                    v.emplace_hint(v.end(), std::move(item));
+                }
+            } else if constexpr (detail::IsBoolVector<Type>::value) {
+                const uint64_t count = loadCount();
+                v.clear();
+                for (uint64_t i = 0; i < count; ++i) {
+                    bool item = false;
+                    load(item);
+                    v.push_back(item);
+                }
+            } else if constexpr (detail::SequenceLike<Type>) {
+                const uint64_t count = loadCount();
+                v.clear();
+                for (uint64_t i = 0; i < count; ++i) {
+                    load(v.emplace_back());
+                }
+            } else {
+                static_assert(detail::AlwaysFalse<Type>, "Tipo não suportado pelo BinaryInputArchive");
+            }
+        }
+
+        [[nodiscard]] size_t remaining() const { return input_.size() - pos_; }
+
+    private:
+        void copyOut(void* target, size_t size) {
+            if (size > remaining()) {
+                throw ArchiveError("archive truncado");
+            }
+            std::memcpy(target, input_.data() + pos_, size);
+            pos_ += size;
+        }
+
+        uint64_t loadCount() {
+            uint64_t count = 0;
+            copyOut(&count, sizeof(count));
+            return count;
+        }
+
+        bool loadFlag() {
+            uint8_t flag = 0;
+            copyOut(&flag, sizeof(flag));
+            return flag != 0;
+        }
+
+        template<typename V, size_t... I>
+        void loadVariant(V& v, uint64_t index, std::index_sequence<I...>) {
+            ((index == I ? (load(v.template emplace<I>()), true) : false) || ...);
+        }
+
+        std::string_view input_;
+        size_t pos_ = 0;
+    };
+}
+
+#endif //CPP_SERIALIZER_BINARYARCHIVE_H
@@ -0,0 +1,56 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_BUILDMANIFEST_H
+#define CPP_SERIALIZER_BUILDMANIFEST_H
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace serializer {
+    /**
+     * Saídas para o sistema de build (--manifest e --depfile).
+     *
+     * O manifesto (JSON) diz qual header gerou quais arquivos e de quais
+     * headers cada classe depende; o depfile (formato do -MD do gcc) lista
+     * os headers lidos, para o Ninja/Make só rodarem o gerador quando um
+     * deles mudar. Caminhos sempre absolutos e normalizados.
+     */
+    class BuildManifest {
+    public:
+        struct Entry {
+            std::string className;
+            std::filesystem::path header;
+            std::vector<std::filesystem::path> dependencies;   // Headers das classes usadas nos campos
+            std::vector<std::filesystem::path> outputs;        // Arquivos gerados para a classe
+        };
+
+        void add(Entry entry);
+        void clear() { entries_.clear(); }
+
+        [[nodiscard]] std::string toJson() const;
+
+        /**
+         * Regra única "alvo: headers" do depfile
+         * @param targets Alvos da regra (o manifesto, ou os arquivos gerados se não houver manifesto)
+         */
+        [[nodiscard]] std::string toDepfile(const std::vector<std::filesystem::path>& targets) const;
+
+        // Todos os arquivos gerados, na ordem das entradas
+        [[nodiscard]] std::vector<std::filesystem::path> outputs() const;
+
+        /**
+         * Grava o arquivo sempre (temporário + rename): a data nova marca a
+         * execução para o Make, e o build nunca lê um arquivo pela metade
+         * @return false se não foi possível gravar
+         */
+        static bool write(const std::filesystem::path& path, const std::string& content);
+
+    private:
+        std::vector<Entry> entries_;
+    };
+}
+
+#endif //CPP_SERIALIZER_BUILDMANIFEST_H
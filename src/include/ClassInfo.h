@@ -11,6 +11,7 @@
 #include <vector>
 #include <set>
 #include <optional>
+#include <ranges>
 
 namespace serializer {
     // Enum para modificadores de acesso
@@ -60,6 +61,11 @@ namespace serializer {
         std::filesystem::path sourceFile;    // Arquivo onde está definida
         bool isStruct = false;               // É struct (true) ou class (false)?
 
+        // Posições no header, vindas do lexer: início do corpo e o '}' que fecha a
+        // classe (onde modifyOriginalClass insere as declarações). npos = não achou
+        size_t bodyBegin = std::string::npos;
+        size_t bodyEnd = std::string::npos;
+
         // Conteúdo da classe
         std::vector<FieldInfo> fields;       // Campos/membros dados
         std::vector<BaseClassInfo> baseClasses; // Classes base (herança)
@@ -89,21 +95,17 @@ namespace serializer {
         explicit ClassInfo(std::string className) : name(std::move(className)) {}
 
         // Métodos de utilidade
-        [[nodiscard]] std::vector<FieldInfo> getSerializableFields() const {
-            std::vector<FieldInfo> result;
-            for (const auto& field : fields) {
-                if (field.access == AccessSpecifier::Public && !field.isTransient) {
-                    result.push_back(field);
-                }
-            }
-            return result;
+        [[nodiscard]] static bool isSerializableField(const FieldInfo& field) {
+            return field.access == AccessSpecifier::Public && !field.isTransient;
+        }
+
+        // Campos públicos e sem TRANSIENT: view filtrada sobre fields, sem cópia
+        [[nodiscard]] auto serializableFields() const {
+            return fields | std::views::filter(&ClassInfo::isSerializableField);
         }
 
         [[nodiscard]] size_t getSerializableFieldCount() const {
-            return std::count_if(fields.begin(), fields.end(),
-                [](const FieldInfo& f) {
-                    return f.access == AccessSpecifier::Public && !f.isTransient;
-                });
+            return std::ranges::count_if(fields, &ClassInfo::isSerializableField);
         }
 
         [[nodiscard]] bool hasPublicFields() const {
@@ -0,0 +1,88 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_CLASSTABLE_H
+#define CPP_SERIALIZER_CLASSTABLE_H
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory_resource>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ClassInfo.h"
+
+namespace serializer {
+    using ClassId = uint32_t;
+
+    /**
+     * Tabela central das classes encontradas.
+     *
+     * Cada ClassInfo existe uma única vez, num slot de endereço estável
+     * (std::deque), e é referenciado pelo ClassId em todas as passadas:
+     * dependências, ordenação e geração trabalham sobre referências para a
+     * tabela, sem cópias. Nomes são internados numa arena, e o índice por
+     * nome usa essas views como chave.
+     */
+    class ClassTable {
+    public:
+        static constexpr ClassId NONE = static_cast<ClassId>(-1);
+
+        ClassTable() = default;
+        ClassTable(const ClassTable&) = delete;
+        ClassTable& operator=(const ClassTable&) = delete;
+
+        /**
+         * Adiciona uma classe; se já existe uma com o mesmo nome, ela é substituída (mesmo ID)
+         * @param classInfo Classe parseada
+         * @param header Header onde a classe foi encontrada
+         * @return ID estável da classe
+         */
+        ClassId add(ClassInfo classInfo, std::filesystem::path header);
+
+        // Remove a classe; o slot é reaproveitado por um add futuro
+        void remove(ClassId id);
+
+        [[nodiscard]] ClassId find(std::string_view name) const;
+        [[nodiscard]] bool contains(std::string_view name) const { return find(name) != NONE; }
+
+        [[nodiscard]] ClassInfo& operator[](ClassId id) { return slots_[id].info; }
+        [[nodiscard]] const ClassInfo& operator[](ClassId id) const { return slots_[id].info; }
+        [[nodiscard]] const std::filesystem::path& header(ClassId id) const { return slots_[id].header; }
+
+        // IDs das classes vivas, na ordem dos headers (a mesma da execução completa)
+        [[nodiscard]] const std::vector<ClassId>& ids() const { return order_; }
+        [[nodiscard]] size_t size() const { return order_.size(); }
+        [[nodiscard]] bool empty() const { return order_.empty(); }
+
+        // Reordena ids() por header e nome (depois de adds fora de ordem)
+        void sortByHeader();
+
+        /**
+         * Interna uma string: a view devolvida vive enquanto a tabela existir
+         * e é a mesma para conteúdos iguais
+         */
+        std::string_view intern(std::string_view text);
+
+    private:
+        struct Slot {
+            ClassInfo info;
+            std::filesystem::path header;
+            bool live = false;
+        };
+
+        std::deque<Slot> slots_;
+        std::vector<ClassId> freeSlots_;
+        std::vector<ClassId> order_;
+        std::unordered_map<std::string_view, ClassId> byName_;
+
+        std::pmr::monotonic_buffer_resource arena_;
+        std::unordered_set<std::string_view> strings_;
+    };
+}
+
+#endif //CPP_SERIALIZER_CLASSTABLE_H
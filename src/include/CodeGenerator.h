@@ -8,6 +8,7 @@
 #include "ClassInfo.h"
 #include "TypeChecker.h"
 #include <filesystem>
+#include <functional>
 #include <optional>
 #include <string>
 #include <vector>
@@ -22,7 +23,7 @@ namespace serializer {
          * @param classInfo Informações da classe
          * @param outputDir Diretório de saída
          * @param typeChecker TypeChecker para análise de tipos
-         * @return Caminho do arquivo gerado
+         * @return Caminho do header gerado (com --out-of-line, também grava Classe_serialization.cpp)
          */
         [[nodiscard]] std::optional<std::filesystem::path> generateImplFile(
             const ClassInfo& classInfo,
@@ -30,6 +31,17 @@ namespace serializer {
             const TypeChecker& typeChecker
         ) const;
 
+        /**
+         * Arquivos que generateImplFile grava para a classe (--manifest e --depfile)
+         * @param classInfo Informações da classe
+         * @param outputDir Diretório de saída
+         * @return O header gerado e, com --out-of-line, o .cpp
+         */
+        [[nodiscard]] std::vector<std::filesystem::path> outputFiles(
+            const ClassInfo& classInfo,
+            const std::filesystem::path& outputDir
+        ) const;
+
         /**
          * Gera serialização para múltiplas classes (com resolução de dependências)
          * @param classes Lista de classes para gerar
@@ -54,14 +66,39 @@ namespace serializer {
             const ClassInfo& classInfo
         ) const;
 
+        // Arquivos escritos e lidos pela geração (--profile)
+        struct Stats {
+            uint64_t filesWritten = 0;
+            uint64_t filesUnchanged = 0;    // Conteúdo igual: arquivo mantido
+            uint64_t bytesWritten = 0;
+            uint64_t bytesRead = 0;
+        };
+
+        [[nodiscard]] const Stats& stats() const { return stats_; }
+        void resetStats() { stats_ = Stats(); }
+
         // Configurações
         void setGenerateJson(bool gen) { generateJson_ = gen; }
         void setGenerateGeneric(bool gen) { generateGeneric_ = gen; }
+        void setGenerateBinary(bool gen) { generateBinary_ = gen; }
+        void setGeneratePmr(bool gen) { generatePmr_ = gen; }
         void setMaxDepth(int depth) { maxDepth_ = depth; }
         void setIndentSize(int size) { indentSize_ = size; }
         void setGenerateRecursive(bool gen) { generateRecursive_ = gen; }
+        // Só funções livres no arquivo gerado; o header original não é tocado
+        void setNonIntrusive(bool enabled) { nonIntrusive_ = enabled; }
+        [[nodiscard]] bool nonIntrusive() const { return nonIntrusive_; }
+        // Corpos num Classe_serialization.cpp; o *_serialization_impl.h só declara
+        void setOutOfLine(bool enabled) { outOfLine_ = enabled; }
 
     private:
+        /**
+         * Recusa campos que nenhum leitor consegue preencher: std::string_view não
+         * é dona do texto e ficaria apontando para o buffer de entrada já liberado
+         * @return false (depois de explicar o motivo) se a classe tem algum
+         */
+        [[nodiscard]] bool checkReadableFields(const ClassInfo& classInfo) const;
+
         // Geração de conteúdo
         [[nodiscard]] std::string generateMethodDeclarations(
             const ClassInfo& classInfo
@@ -72,33 +109,200 @@ namespace serializer {
             const TypeChecker& typeChecker
         ) const;
 
+        /**
+         * Gera o .cpp do modo --out-of-line: os mesmos corpos do header
+         * inline, sem "inline", e as instanciações explícitas dos métodos
+         * template para os archives do BinaryArchive.h
+         */
+        [[nodiscard]] std::string generateSourceContent(
+            const ClassInfo& classInfo,
+            const TypeChecker& typeChecker
+        ) const;
+
+        // STL, nlohmann e headers de runtime usados pelos corpos gerados
+        [[nodiscard]] std::string generateLibraryIncludes() const;
+
+        // #include "Dep_serialization_impl.h" de cada dependência
+        [[nodiscard]] std::string generateDependencyImplIncludes(
+            const ClassInfo& classInfo
+        ) const;
+
+        // Corpos de todos os métodos (ou funções livres, no modo --non-intrusive)
+        [[nodiscard]] std::string generateMethodBodies(
+            const ClassInfo& classInfo,
+            const TypeChecker& typeChecker
+        ) const;
+
+        /**
+         * Declarações do modo --non-intrusive: to_json/from_json (nlohmann),
+         * serializeTo/readJson, writeBinary/readBinary, os tamanhos e os
+         * atalhos como funções livres no namespace da classe, achadas por
+         * ADL. Só campos públicos, como no modo membro.
+         */
+        [[nodiscard]] std::string generateFreeFunctionDeclarations(
+            const ClassInfo& classInfo
+        ) const;
+
+        [[nodiscard]] std::string generateJsonConversionFunctions(
+            const ClassInfo& classInfo
+        ) const;
+
+        /**
+         * Gera o lote colunar de std::vector<Classe> (Columnar.h): writeColumns
+         * e readColumns em JSON (um array por campo) e em binário (uma coluna
+         * por campo). Funções livres no namespace da classe nos dois modos,
+         * achadas por ADL a partir do vector. Vazio se não há campos.
+         */
+        [[nodiscard]] std::string generateColumnarFunctions(
+            const ClassInfo& classInfo
+        ) const;
+
+        // Declarações de writeColumns/readColumns (header do --out-of-line)
+        [[nodiscard]] std::string generateColumnarDeclarations(
+            const ClassInfo& classInfo
+        ) const;
+
+        // "inline void writeColumns(serializer::JsonWriter& out, const std::vector<Classe>& rows)"
+        [[nodiscard]] std::string generateColumnsSignature(
+            const ClassInfo& classInfo,
+            const std::string& name,
+            const std::string& stream,
+            bool isConst
+        ) const;
+
+        /**
+         * Assinatura de um método gerado: "inline void Classe::nome(params) const"
+         * ou, no modo não intrusivo, "inline void nome(params, const Classe& obj)"
+         */
+        [[nodiscard]] std::string generateSignature(
+            const ClassInfo& classInfo,
+            const std::string& returnType,
+            const std::string& name,
+            const std::string& params,
+            bool isConst
+        ) const;
+
+        // Chamada a um método gerado: "objeto.nome(args)" ou "nome(args, objeto)"
+        [[nodiscard]] std::string generateCall(
+            const std::string& name,
+            const std::string& object,
+            const std::string& args
+        ) const;
+
+        // Prefixo de acesso aos campos nos corpos gerados ("" ou "obj.")
+        [[nodiscard]] std::string selfPrefix() const { return nonIntrusive_ ? "obj." : ""; }
+
+        // Os corpos só são inline quando ficam no header
+        [[nodiscard]] std::string inlineSpecifier() const { return outOfLine_ ? "" : "inline "; }
+
+        /**
+         * Grava o arquivo só se o conteúdo mudou (manter a data evita recompilar quem inclui)
+         * @return false se não foi possível gravar
+         */
+        [[nodiscard]] bool writeIfChanged(
+            const std::filesystem::path& path,
+            const std::string& content
+        ) const;
+
         [[nodiscard]] std::string generateSerializeMethod(
             const ClassInfo& classInfo,
             const TypeChecker& typeChecker
         ) const;
 
+        [[nodiscard]] std::string generateStreamingSerializeMethods(
+            const ClassInfo& classInfo,
+            const TypeChecker& typeChecker
+        ) const;
+
         [[nodiscard]] std::string generateDeserializeMethod(
             const ClassInfo& classInfo,
             const TypeChecker& typeChecker
         ) const;
 
+        /**
+         * Gera deserializeInto(): sobrescreve os campos no lugar via
+         * serializer::assignFromJson, mantendo a capacidade já alocada
+         */
+        [[nodiscard]] std::string generateDeserializeIntoMethod(
+            const ClassInfo& classInfo,
+            const TypeChecker& typeChecker
+        ) const;
+
+        [[nodiscard]] std::string generateStreamingDeserializeMethods(
+            const ClassInfo& classInfo,
+            const TypeChecker& typeChecker
+        ) const;
+
+        /**
+         * Gera o despacho de chaves do leitor em streaming: switch pelo tamanho
+         * da chave e, dentro de cada tamanho, pelo caractere que melhor separa
+         * os nomes (hash perfeito calculado na geração). Cada case confirma com
+         * uma única comparação e faz "continue" no laço de chaves.
+         */
+        [[nodiscard]] std::string generateKeyDispatch(
+            const ClassInfo& classInfo,
+            const std::function<std::string(const FieldInfo&)>& readStatement,
+            int indentLevel
+        ) const;
+
         [[nodiscard]] std::string generateFromJsonMethod(
             const ClassInfo& classInfo,
             const TypeChecker& typeChecker
         ) const;
 
+        [[nodiscard]] std::string generateBinaryMethods(
+            const ClassInfo& classInfo,
+            const TypeChecker& typeChecker
+        ) const;
+
+        [[nodiscard]] std::string generateFieldwiseBinaryMethods(
+            const ClassInfo& classInfo,
+            const TypeChecker& typeChecker
+        ) const;
+
+        [[nodiscard]] std::string generateSizeMethods(
+            const ClassInfo& classInfo,
+            const TypeChecker& typeChecker
+        ) const;
+
         [[nodiscard]] std::string generateGenericMethods(
             const ClassInfo& classInfo
         ) const;
 
+        /**
+         * Gera useMemoryResource() e as sobrecargas de desserialização que
+         * recebem um std::pmr::memory_resource (modo --pmr)
+         */
+        [[nodiscard]] std::string generatePmrMethods(
+            const ClassInfo& classInfo,
+            const TypeChecker& typeChecker
+        ) const;
+
         bool needsJsonGet(const std::string &type) const;
 
+        // Classe só com campos primitivos (candidata ao caminho memcpy no binário)
+        [[nodiscard]] bool isFlatPrimitiveClass(
+            const ClassInfo& classInfo,
+            const TypeChecker& typeChecker
+        ) const;
+
+        // Container com algum argumento de template serializável (ex: std::vector<Usuario>)
+        [[nodiscard]] bool hasSerializableArgs(
+            const TypeChecker::TypeAnalysis& analysis,
+            const TypeChecker& typeChecker
+        ) const;
+
         // Serialização de containers complexos
         [[nodiscard]] std::string generateContainerSerialization(
             const FieldInfo& field,
             const TypeChecker& typeChecker
         ) const;
 
+        /**
+         * Gera o preenchimento de um container de serializáveis direto no
+         * membro: clear() mantém a capacidade, reserve() pelo tamanho do JSON
+         * e cada elemento é construído no lugar (emplace_back/emplace_hint)
+         */
         [[nodiscard]] std::string generateContainerDeserialization(
             const FieldInfo& field,
             const std::string& jsonVar,
@@ -129,9 +333,16 @@ namespace serializer {
         // Configurações
         bool generateJson_ = true;
         bool generateGeneric_ = true;
+        bool generateBinary_ = true;
+        bool generatePmr_ = false;
         bool generateRecursive_ = true;
+        bool nonIntrusive_ = false;
+        bool outOfLine_ = false;
         int maxDepth_ = 4;
         int indentSize_ = 4;
+
+        // Geração é sequencial: contadores simples, atualizados pelos métodos const
+        mutable Stats stats_;
     };
 }
 
@@ -0,0 +1,253 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_COLUMNAR_H
+#define CPP_SERIALIZER_COLUMNAR_H
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "JsonReader.h"
+#include "JsonWriter.h"
+#include "WireFormat.h"
+
+/*
+ * Lotes colunares (structure-of-arrays) de std::vector<Classe>:
+ *
+ *  - JSON ......... {"campo": [v0, v1, ...], ...}: um array por campo, sem
+ *                   repetir as chaves a cada linha
+ *  - binário ...... varint(linhas) + uma coluna por campo, na ordem de declaração:
+ *                   primitivos (exceto bool e long double) com sizeof(T) bytes
+ *                   little-endian cada, bool em bits empacotados, o resto com
+ *                   a codificação normal do WireWriter, linha a linha
+ *
+ * As funções writeColumns/readColumns de cada classe são geradas junto com a
+ * serialização dela; as funções abaixo fazem o trabalho de cada coluna.
+ */
+namespace serializer {
+    namespace detail {
+        // Tipo do campo apontado por um ponteiro para membro
+        template<typename Row, typename Member>
+        using ColumnField = std::remove_cvref_t<decltype(std::declval<const Row&>().*std::declval<Member>())>;
+
+        // Menor largura (em bits) que um valor do campo ocupa na coluna binária
+        template<typename Field>
+        constexpr size_t minColumnBits() {
+            if constexpr (BlockElement<Field>) {
+                return sizeof(Field) * 8;
+            } else if constexpr (std::is_same_v<Field, bool>) {
+                return 1;
+            } else if constexpr (HasFreeWriteBinary<Field> || HasWriteBinary<Field> ||
+                                 IsPair<Field>::value || IsTuple<Field>::value || IsStdArray<Field>::value) {
+                return 0;   // Objetos e agregados podem não ocupar nada (classe sem campos, array vazio)
+            } else {
+                return 8;   // Varint, tamanho, flag de optional ou índice de variant: ao menos um byte
+            }
+        }
+    }
+
+    /**
+     * Menor tamanho (em bits) de uma linha na forma colunar binária: limita a
+     * quantidade de linhas que uma mensagem de n bytes pode declarar
+     * Recebe os ponteiros para os campos da classe (&Classe::campo, ...): só os tipos importam
+     */
+    template<typename Row, typename... Members>
+    constexpr size_t minRowBits(Members Row::*...) {
+        return (size_t{0} + ... + detail::minColumnBits<std::remove_cvref_t<Members>>());
+    }
+
+    /**
+     * Escreve "nome": [valores] com o campo de cada linha
+     * @param out Writer posicionado dentro do objeto do lote
+     * @param name Nome do campo (chave da coluna)
+     * @param rows Linhas do lote
+     * @param member Ponteiro para o campo (&Classe::campo)
+     */
+    template<typename Row, typename Member>
+    void writeColumn(JsonWriter& out, std::string_view name, const std::vector<Row>& rows, Member member) {
+        out.key(name);
+        out.beginArray();
+        for (const auto& row : rows) {
+            out.value(row.*member);
+        }
+        out.endArray();
+    }
+
+    /**
+     * Leitura de um lote colunar em JSON: a primeira coluna lida define a
+     * quantidade de linhas, e as demais precisam ter o mesmo tamanho. As
+     * linhas que já existem no vector são sobrescritas (mantendo a memória),
+     * por isso todas as colunas da classe são obrigatórias.
+     */
+    template<typename Row>
+    class JsonColumnReader {
+    public:
+        /**
+         * @param in Reader posicionado antes do objeto do lote
+         * @param rows Linhas a sobrescrever
+         * @param columns Nomes de todas as colunas da classe, na ordem dos índices de read()
+         */
+        JsonColumnReader(JsonReader& in, std::vector<Row>& rows, std::initializer_list<std::string_view> columns)
+            : in_(in), rows_(rows), columns_(columns), seen_(columns.size(), false) {}
+
+        template<typename Member>
+        void read(size_t column, Member member) {
+            seen_[column] = true;
+            size_t count = 0;
+            in_.beginArray();
+            while (in_.nextElement()) {
+                if (count == rows_.size()) {
+                    if (sized_) {
+                        throw JsonParseError("coluna com mais linhas que as anteriores", in_.position());
+                    }
+                    rows_.emplace_back();
+                }
+                in_.read(rows_[count].*member);
+                ++count;
+            }
+
+            if (!sized_) {
+                rows_.resize(count);
+                sized_ = true;
+            } else if (count != rows_.size()) {
+                throw JsonParseError("coluna com menos linhas que as anteriores", in_.position());
+            }
+        }
+
+        // Fim do objeto: coluna ausente deixaria o campo das linhas reaproveitadas com o valor antigo
+        void finish() {
+            for (size_t i = 0; i < columns_.size(); ++i) {
+                if (!seen_[i]) {
+                    throw JsonParseError("coluna ausente: " + std::string(columns_[i]), in_.position());
+                }
+            }
+            if (!sized_) {
+                rows_.clear();   // Classe sem campos
+            }
+        }
+
+    private:
+        JsonReader& in_;
+        std::vector<Row>& rows_;
+        std::vector<std::string_view> columns_;
+        std::vector<bool> seen_;
+        bool sized_ = false;
+    };
+
+    // Escreve a coluna de um campo (ver o formato no topo do arquivo)
+    template<typename Row, typename Member>
+    void writeColumn(WireWriter& out, const std::vector<Row>& rows, Member member) {
+        using Field = detail::ColumnField<Row, Member>;
+
+        if constexpr (detail::BlockElement<Field> && detail::LittleEndianHost) {
+            // Largura fixa: reserva a coluna inteira e copia campo a campo, sem varint
+            std::string& buffer = out.buffer();
+            const size_t offset = buffer.size();
+            buffer.resize(offset + rows.size() * sizeof(Field));
+            char* target = buffer.data() + offset;
+            for (const auto& row : rows) {
+                std::memcpy(target, &(row.*member), sizeof(Field));
+                target += sizeof(Field);
+            }
+        } else if constexpr (detail::BlockElement<Field>) {
+            for (const auto& row : rows) {
+                out.fixedValue(row.*member);
+            }
+        } else if constexpr (std::is_same_v<Field, bool>) {
+            uint8_t bits = 0;
+            for (size_t i = 0; i < rows.size(); ++i) {
+                if (rows[i].*member) bits |= static_cast<uint8_t>(1u << (i % 8));
+                if (i % 8 == 7) {
+                    out.byte(bits);
+                    bits = 0;
+                }
+            }
+            if (rows.size() % 8 != 0) out.byte(bits);
+        } else {
+            for (const auto& row : rows) {
+                out.value(row.*member);
+            }
+        }
+    }
+
+    /**
+     * Lê a quantidade de linhas do lote e ajusta o vector (as linhas que já
+     * existem são sobrescritas pelas colunas, mantendo a memória)
+     * @param rowBits Menor tamanho de uma linha em bits (minRowBits da classe)
+     */
+    template<typename Row>
+    void readRowCount(WireReader& in, std::vector<Row>& rows, size_t rowBits) {
+        const uint64_t count = in.varint();
+        // Não confia em contagens que o resto da mensagem não comporta: o resize
+        // constrói todas as linhas antes de a primeira coluna falhar
+        const uint64_t available = in.remaining() * uint64_t{8};
+        if (rowBits > 0 ? count > available / rowBits : count / 8 > in.remaining()) {
+            throw WireFormatError("mensagem binária truncada");
+        }
+        rows.resize(count);
+    }
+
+    // Contraparte de writeColumn(WireWriter&, ...): rows já tem a quantidade de linhas
+    template<typename Row, typename Member>
+    void readColumn(WireReader& in, std::vector<Row>& rows, Member member) {
+        using Field = detail::ColumnField<Row, Member>;
+
+        if constexpr (detail::BlockElement<Field> && detail::LittleEndianHost) {
+            const char* source = in.bytes(rows.size() * sizeof(Field)).data();
+            for (auto& row : rows) {
+                std::memcpy(&(row.*member), source, sizeof(Field));
+                source += sizeof(Field);
+            }
+        } else if constexpr (detail::BlockElement<Field>) {
+            for (auto& row : rows) {
+                in.readFixed(row.*member);
+            }
+        } else if constexpr (std::is_same_v<Field, bool>) {
+            const std::string_view packed = in.bytes((rows.size() + 7) / 8);
+            for (size_t i = 0; i < rows.size(); ++i) {
+                rows[i].*member = (static_cast<uint8_t>(packed[i / 8]) >> (i % 8)) & 1u;
+            }
+        } else {
+            for (auto& row : rows) {
+                in.read(row.*member);
+            }
+        }
+    }
+
+    // Atalhos para o lote inteiro num buffer; writeColumns/readColumns da classe são achadas por ADL
+
+    template<typename Row>
+    void writeColumnsJson(std::string& out, const std::vector<Row>& rows) {
+        JsonWriter writer(out);
+        writeColumns(writer, rows);
+    }
+
+    template<typename Row>
+    void readColumnsJson(std::string_view json, std::vector<Row>& rows) {
+        JsonReader in(json);
+        readColumns(in, rows);
+        in.finish();
+    }
+
+    template<typename Row>
+    void writeColumnsBinary(std::string& out, const std::vector<Row>& rows) {
+        WireWriter writer(out);
+        writeColumns(writer, rows);
+    }
+
+    template<typename Row>
+    void readColumnsBinary(std::string_view data, std::vector<Row>& rows) {
+        WireReader in(data);
+        readColumns(in, rows);
+        in.finish();
+    }
+}
+
+#endif //CPP_SERIALIZER_COLUMNAR_H
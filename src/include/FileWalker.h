@@ -6,17 +6,55 @@
 #define CPP_SERIALIZER_FILEWALKER_H
 
 #include <filesystem>
+#include <optional>
 #include <vector>
 #include <string>
 
 namespace serializer {
+    // Como a lista de headers é montada
+    struct WalkOptions {
+        std::vector<std::string> ignorePatterns;                    // --ignore GLOB (sintaxe do .gitignore)
+        bool useGitignore = true;                                   // --no-gitignore desliga
+        std::optional<std::filesystem::path> compileCommands;       // --compile-commands ARQUIVO
+    };
+
+    // Números da última busca (--profile)
+    struct WalkStats {
+        size_t entriesVisited = 0;      // Arquivos e diretórios listados
+        size_t directoriesSkipped = 0;  // Diretórios podados (nada abaixo deles é listado)
+    };
+
     class FileWalker {
     public:
         static std::vector<std::filesystem::path> findHeaderFiles(const std::filesystem::path& projectPath) ;
 
-    private:
+        /**
+         * Procura headers aplicando as opções de exclusão
+         * @param projectPath Raiz do projeto
+         * @param options Padrões ignorados, .gitignore e compile_commands.json
+         * @param stats Recebe os números da busca (opcional)
+         * @return Headers encontrados, ordenados
+         */
+        static std::vector<std::filesystem::path> findHeaderFiles(const std::filesystem::path& projectPath,
+                                                                  const WalkOptions& options,
+                                                                  WalkStats* stats = nullptr) ;
+
+        /**
+         * Lista os diretórios que a busca percorreria (start incluso), com as mesmas podas
+         * @param projectPath Raiz do projeto (base do .gitignore e dos padrões)
+         * @param options Padrões ignorados e .gitignore (compileCommands não se aplica)
+         * @param start Subdiretório onde começar (vazio = a raiz); nada é devolvido se ele estiver podado
+         * @param headers Recebe os headers encontrados no caminho (opcional)
+         */
+        static std::vector<std::filesystem::path> findDirectories(const std::filesystem::path& projectPath,
+                                                                  const WalkOptions& options,
+                                                                  const std::filesystem::path& start = {},
+                                                                  std::vector<std::filesystem::path>* headers = nullptr) ;
+
         static bool isHeaderFile(const std::filesystem::path& path) ;
 
+    private:
+
         std::vector<std::string> ignoreDirectories = {
             ".git", ".svn", ".vs", "build", "cmake-build-",
             "__pycache__", "node_modules"
@@ -24,4 +62,4 @@ namespace serializer {
     };
 }
 
-#endif //CPP_SERIALIZER_FILEWALKER_H
\ No newline at end of file
+#endif //CPP_SERIALIZER_FILEWALKER_H
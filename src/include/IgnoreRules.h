@@ -0,0 +1,65 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_IGNORERULES_H
+#define CPP_SERIALIZER_IGNORERULES_H
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace serializer {
+    /**
+     * Regras de exclusão no formato do .gitignore.
+     *
+     * Suporta "*", "?", "[...]", "**", "!" (reinclusão), "/" inicial
+     * (ancorado) e "/" final (só diretórios). Cada regra guarda o diretório
+     * (relativo à raiz do projeto) do .gitignore de onde veio; a última regra
+     * que casar decide, como no git.
+     */
+    class IgnoreRules {
+    public:
+        /**
+         * Adiciona um padrão
+         * @param pattern Linha no formato do .gitignore
+         * @param base Diretório relativo à raiz ("" para a raiz, senão terminado em "/")
+         */
+        void addPattern(std::string_view pattern, const std::string& base = "");
+
+        /**
+         * Carrega um arquivo .gitignore
+         * @param file Caminho do arquivo
+         * @param base Diretório do arquivo relativo à raiz ("" ou terminado em "/")
+         * @return false se o arquivo não existe ou não pôde ser lido
+         */
+        bool loadFile(const std::filesystem::path& file, const std::string& base = "");
+
+        /**
+         * Verifica se um caminho deve ser ignorado
+         * @param relativePath Caminho relativo à raiz, separado por "/"
+         * @param isDirectory Se o caminho é um diretório
+         */
+        [[nodiscard]] bool isIgnored(std::string_view relativePath, bool isDirectory) const;
+
+        [[nodiscard]] bool empty() const { return rules_.empty(); }
+
+        /**
+         * Casa um glob com um texto ("*" e "?" não atravessam "/", "**" sim)
+         */
+        [[nodiscard]] static bool matchGlob(std::string_view pattern, std::string_view text);
+
+    private:
+        struct Rule {
+            std::string pattern;
+            std::string base;
+            bool negated = false;
+            bool directoryOnly = false;
+        };
+
+        std::vector<Rule> rules_;
+    };
+}
+
+#endif //CPP_SERIALIZER_IGNORERULES_H
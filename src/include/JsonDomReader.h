@@ -0,0 +1,220 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_JSONDOMREADER_H
+#define CPP_SERIALIZER_JSONDOMREADER_H
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <nlohmann/json.hpp>
+
+#include "TypeTraits.h"
+
+namespace serializer {
+    namespace detail {
+        template<typename T>
+        concept HasDeserializeInto = requires(T& obj, const nlohmann::json& json) {
+            obj.deserializeInto(json);
+        };
+
+        // Map ordenado com node handles: os nós existentes podem ser reaproveitados com chave nova
+        template<typename T>
+        concept ReusableNodeMap = MapLike<T> && !HasReserve<T> && requires(T& map) {
+            typename T::node_type;
+            map.extract(map.begin());
+        };
+
+        inline void requireJsonType(const nlohmann::json& json, bool matches, const char* expected) {
+            if (!matches) {
+                throw nlohmann::json::type_error::create(
+                    302, std::string("type must be ") + expected + ", but is " + json.type_name(), &json);
+            }
+        }
+    }
+
+    template<typename T>
+    void assignFromJson(T& v, const nlohmann::json& json);
+
+    /**
+     * Atribui o JSON a um map reaproveitando os nós: nos maps ordenados cada
+     * nó existente recebe a chave e o valor novos e é reinserido no fim (as
+     * chaves do nlohmann já vêm ordenadas, então o hint é O(1)). Maps sem
+     * ordem só mantêm os buckets.
+     * @param v Map de destino
+     * @param json Objeto (chaves string) ou array de pares [chave, valor]
+     */
+    template<typename Map>
+    void assignMapFromJson(Map& v, const nlohmann::json& json) {
+        using Key = typename Map::key_type;
+        constexpr bool stringKey = detail::StringLike<Key>;
+
+        if constexpr (stringKey) {
+            detail::requireJsonType(json, json.is_object(), "object");
+        } else {
+            detail::requireJsonType(json, json.is_array(), "array");
+        }
+
+        Map spare(v.get_allocator());
+        if constexpr (detail::ReusableNodeMap<Map>) {
+            spare.swap(v);
+        } else {
+            v.clear();
+            if constexpr (detail::HasReserve<Map>) {
+                v.reserve(json.size());
+            }
+        }
+
+        auto put = [&v, &spare](const auto& assignKey, const nlohmann::json& value) {
+            if constexpr (detail::ReusableNodeMap<Map>) {
+                if (!spare.empty()) {
+                    auto node = spare.extract(spare.begin());
+                    assignKey(node.key());
+                    assignFromJson(node.mapped(), value);
+                    v.insert(v.end(), std::move(node));
+                    return;
+                }
+            }
+            auto key = detail::makeElementFor<Key>(v);
+            assignKey(key);
+            auto entry = v.emplace_hint(v.end(), std::piecewise_construct,
+                                        std::forward_as_tuple(std::move(key)), std::forward_as_tuple());
+            assignFromJson(entry->second, value);
+        };
+
+        if constexpr (stringKey) {
+            for (auto it = json.begin(); it != json.end(); ++it) {
+                const std::string& name = it.key();
+                put([&name](Key& key) { key.assign(name.data(), name.size()); }, it.value());
+            }
+        } else {
+            for (const auto& pair : json) {
+                put([&pair](Key& key) { assignFromJson(key, pair.at(0)); }, pair.at(1));
+            }
+        }
+    }
+
+    /**
+     * Atribui o conteúdo de um nlohmann::json a v reaproveitando o que v já
+     * tem alocado: strings são sobrescritas no lugar, sequências mantêm os
+     * elementos existentes (e a memória deles), maps ordenados reaproveitam
+     * os nós e objetos gerados recursam via deserializeInto. Com a mesma forma
+     * de mensagem, a decodificação em regime não aloca nada.
+     *
+     * O que não tem versão "no lugar" (sets, pares, tuplas) cai no get_to do nlohmann.
+     * @param v Destino
+     * @param json Valor de origem
+     */
+    template<typename T>
+    void assignFromJson(T& v, const nlohmann::json& json) {
+        using Type = std::remove_cvref_t<T>;
+
+        if constexpr (detail::HasDeserializeInto<Type>) {
+            v.deserializeInto(json);
+        } else if constexpr (detail::IsStdString<Type>::value) {
+            const auto& str = json.get_ref<const nlohmann::json::string_t&>();
+            v.assign(str.data(), str.size());
+        } else if constexpr (detail::IsOptional<Type>::value) {
+            if (json.is_null()) {
+                v.reset();
+            } else {
+                if (!v) v.emplace();
+                assignFromJson(*v, json);
+            }
+        } else if constexpr (detail::IsSmartPointer<Type>::value) {
+            if (json.is_null()) {
+                v.reset();
+            } else {
+                if (!v) v.reset(new typename Type::element_type());
+                assignFromJson(*v, json);
+            }
+        } else if constexpr (detail::IsStdArray<Type>::value) {
+            for (size_t i = 0; i < v.size(); ++i) {
+                assignFromJson(v[i], json.at(i));
+            }
+        } else if constexpr (detail::SequenceLike<Type> && !detail::IsBoolVector<Type>::value) {
+            detail::requireJsonType(json, json.is_array(), "array");
+
+            // Sobrescreve os elementos que já existem e só acrescenta o que faltar
+            auto source = json.begin();
+            auto target = v.begin();
+            for (; source != json.end() && target != v.end(); ++source, ++target) {
+                assignFromJson(*target, *source);
+            }
+            v.erase(target, v.end());
+
+            if constexpr (detail::HasReserve<Type>) {
+                v.reserve(json.size());
+            }
+            for (; source != json.end(); ++source) {
+                assignFromJson(v.emplace_back(), *source);
+            }
+        } else if constexpr (detail::MapLike<Type>) {
+            assignMapFromJson(v, json);
+        } else {
+            json.get_to(v);
+        }
+    }
+}
+
+// std::optional no nlohmann::json como o JsonWriter/JsonReader: vazio é null
+namespace nlohmann {
+    template<typename T>
+    struct adl_serializer<std::optional<T>> {
+        template<typename BasicJsonType>
+        static void to_json(BasicJsonType& json, const std::optional<T>& v) {
+            if (v) {
+                json = *v;
+            } else {
+                json = nullptr;
+            }
+        }
+
+        template<typename BasicJsonType>
+        static void from_json(const BasicJsonType& json, std::optional<T>& v) {
+            if (json.is_null()) {
+                v.reset();
+            } else {
+                v = json.template get<T>();
+            }
+        }
+    };
+}
+
+// std::variant no nlohmann::json no mesmo formato do JsonWriter/JsonReader: {"index": i, "value": ...}
+namespace nlohmann {
+    template<typename... Ts>
+    struct adl_serializer<std::variant<Ts...>> {
+        template<typename BasicJsonType>
+        static void to_json(BasicJsonType& json, const std::variant<Ts...>& v) {
+            std::visit([&](const auto& item) {
+                json = BasicJsonType{{"index", v.index()}, {"value", item}};
+            }, v);
+        }
+
+        template<typename BasicJsonType>
+        static void from_json(const BasicJsonType& json, std::variant<Ts...>& v) {
+            const auto index = json.at("index").template get<std::size_t>();
+            if (index >= sizeof...(Ts)) {
+                throw typename BasicJsonType::out_of_range(
+                    BasicJsonType::out_of_range::create(401, "índice de variant inválido", &json));
+            }
+            fromJson(json.at("value"), v, index, std::index_sequence_for<Ts...>{});
+        }
+
+    private:
+        template<typename BasicJsonType, std::size_t... I>
+        static void fromJson(const BasicJsonType& json, std::variant<Ts...>& v, std::size_t index,
+                             std::index_sequence<I...>) {
+            ((index == I ? (v.template emplace<I>(json.template get<Ts>()), true) : false) || ...);
+        }
+    };
+}
+
+#endif //CPP_SERIALIZER_JSONDOMREADER_H
@@ -0,0 +1,583 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_JSONREADER_H
+#define CPP_SERIALIZER_JSONREADER_H
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "TypeTraits.h"
+
+namespace serializer {
+    class JsonReader;
+
+    namespace detail {
+        template<typename T>
+        concept HasReadJson = requires(T& obj, JsonReader& in) {
+            obj.readJson(in);
+        };
+
+        // readJson(in, obj) livre, achada por ADL (modo --non-intrusive)
+        template<typename T>
+        concept HasFreeReadJson = requires(T& obj, JsonReader& in) {
+            readJson(in, obj);
+        };
+    }
+
+    // Erro de sintaxe/tipo durante a leitura em streaming
+    class JsonParseError : public std::runtime_error {
+    public:
+        JsonParseError(const std::string& message, size_t offset)
+            : std::runtime_error(message + " (posição " + std::to_string(offset) + ")"),
+              offset_(offset) {}
+
+        [[nodiscard]] size_t offset() const { return offset_; }
+
+    private:
+        size_t offset_;
+    };
+
+    /**
+     * Leitor JSON pull: tokeniza o texto sob demanda e escreve direto nos
+     * membros, sem montar o DOM do nlohmann::json.
+     *
+     * Strings sem escape são devolvidas como views do próprio texto de
+     * entrada; com escape, são decodificadas num buffer interno reutilizado.
+     *
+     * Com um memory_resource, objetos gerados com --pmr criados durante a
+     * leitura (elementos de containers, optionals) passam a alocar nele.
+     */
+    class JsonReader {
+    public:
+        explicit JsonReader(std::string_view input, std::pmr::memory_resource* resource = nullptr)
+            : input_(input), resource_(resource) {}
+
+        // Limite de aninhamento: cada nível de objeto/array recursa no read/skipValue
+        static constexpr size_t MAX_DEPTH = 512;
+
+        void beginObject() {
+            expect('{');
+            enter();
+        }
+
+        /**
+         * Avança para o próximo campo do objeto atual
+         * @param key Recebe o nome do campo (válido até a próxima leitura de string)
+         * @return false quando o objeto termina ('}' já consumido)
+         */
+        bool nextKey(std::string_view& key) {
+            skipWhitespace();
+            if (peek() == '}') {
+                ++pos_;
+                first_ = false;
+                --depth_;
+                return false;
+            }
+            if (!first_) {
+                expect(',');
+            }
+            key = readString();
+            expect(':');
+            return true;
+        }
+
+        void beginArray() {
+            expect('[');
+            enter();
+        }
+
+        /**
+         * Avança para o próximo elemento do array atual
+         * @return false quando o array termina (']' já consumido)
+         */
+        bool nextElement() {
+            skipWhitespace();
+            if (peek() == ']') {
+                ++pos_;
+                first_ = false;
+                --depth_;
+                return false;
+            }
+            if (!first_) {
+                expect(',');
+            }
+            return true;
+        }
+
+        // Consome um null se ele for o próximo valor
+        bool tryNull() {
+            skipWhitespace();
+            if (input_.substr(pos_, 4) == "null") {
+                pos_ += 4;
+                first_ = false;
+                return true;
+            }
+            return false;
+        }
+
+        std::string_view readString() {
+            skipWhitespace();
+            if (peek() != '"') {
+                fail("string esperada");
+            }
+            ++pos_;
+
+            const size_t start = pos_;
+            while (pos_ < input_.size() && input_[pos_] != '"' && input_[pos_] != '\\') {
+                ++pos_;
+            }
+            if (pos_ >= input_.size()) {
+                fail("string não terminada");
+            }
+
+            first_ = false;
+            if (input_[pos_] == '"') {
+                // Caminho rápido: sem escape, aponta para a entrada
+                return input_.substr(start, pos_++ - start);
+            }
+
+            scratch_.assign(input_.data() + start, pos_ - start);
+            decodeEscapedTail();
+            return scratch_;
+        }
+
+        bool readBool() {
+            skipWhitespace();
+            first_ = false;
+            if (input_.substr(pos_, 4) == "true") {
+                pos_ += 4;
+                return true;
+            }
+            if (input_.substr(pos_, 5) == "false") {
+                pos_ += 5;
+                return false;
+            }
+            fail("booleano esperado");
+        }
+
+        template<typename T>
+        T readNumber() {
+            skipWhitespace();
+            const size_t start = pos_;
+            while (pos_ < input_.size() && isNumberChar(input_[pos_])) {
+                ++pos_;
+            }
+            if (start == pos_) {
+                fail("número esperado");
+            }
+            first_ = false;
+
+            const char* begin = input_.data() + start;
+            const char* end = input_.data() + pos_;
+            T number{};
+
+            if constexpr (std::is_integral_v<T>) {
+                auto [ptr, ec] = std::from_chars(begin, end, number);
+                if (ec == std::errc() && ptr == end) {
+                    return number;
+                }
+                // Aceita "3.0"/"1e3" como o nlohmann faz, truncando
+                double asDouble = 0;
+                auto [dptr, dec] = std::from_chars(begin, end, asDouble);
+                if (dec != std::errc() || dptr != end) {
+                    pos_ = start;
+                    fail("número inválido");
+                }
+                // Fora do intervalo de T (inclusive "300" em uint8_t e "-1" em unsigned) o cast seria UB
+                const double whole = std::trunc(asDouble);
+                if (!(whole >= static_cast<double>(std::numeric_limits<T>::min()) &&
+                      whole < static_cast<double>(std::numeric_limits<T>::max()) + 1.0)) {
+                    pos_ = start;
+                    fail("inteiro fora do intervalo");
+                }
+                return static_cast<T>(whole);
+            } else {
+                auto [ptr, ec] = std::from_chars(begin, end, number);
+                if (ec != std::errc() || ptr != end) {
+                    pos_ = start;
+                    fail("número inválido");
+                }
+                return number;
+            }
+        }
+
+        // Pula o próximo valor (qualquer tipo), usado para campos desconhecidos
+        void skipValue() {
+            skipWhitespace();
+            switch (peek()) {
+                case '{': {
+                    beginObject();
+                    std::string_view key;
+                    while (nextKey(key)) {
+                        skipValue();
+                    }
+                    break;
+                }
+                case '[':
+                    beginArray();
+                    while (nextElement()) {
+                        skipValue();
+                    }
+                    break;
+                case '"':
+                    readString();
+                    break;
+                case 't':
+                case 'f':
+                    readBool();
+                    break;
+                case 'n':
+                    if (!tryNull()) fail("valor inválido");
+                    break;
+                default:
+                    readNumber<double>();
+                    break;
+            }
+        }
+
+        template<typename T>
+        void read(T& v) {
+            using Type = std::remove_cvref_t<T>;
+
+            if constexpr (detail::HasFreeReadJson<Type>) {
+                readJson(*this, v);
+            } else if constexpr (detail::HasReadJson<Type>) {
+                v.readJson(*this);
+            } else if constexpr (std::is_same_v<Type, bool>) {
+                v = readBool();
+            } else if constexpr (std::is_arithmetic_v<Type>) {
+                if constexpr (std::is_floating_point_v<Type>) {
+                    // O writer grava NaN/infinito como null
+                    if (tryNull()) {
+                        v = std::numeric_limits<Type>::quiet_NaN();
+                        return;
+                    }
+                }
+                v = readNumber<Type>();
+            } else if constexpr (std::is_enum_v<Type>) {
+                v = static_cast<Type>(readNumber<std::underlying_type_t<Type>>());
+            } else if constexpr (detail::IsStdString<Type>::value) {
+                std::string_view str = readString();
+                v.assign(str.data(), str.size());
+            } else if constexpr (std::is_same_v<Type, std::string_view>) {
+                static_assert(detail::AlwaysFalse<Type>,
+                              "std::string_view não é dono do texto e não pode ser lida: use std::string");
+            } else if constexpr (detail::IsVariant<Type>::value) {
+                // {"index": i, "value": ...} (ver JsonWriter): o índice precisa vir antes do valor
+                beginObject();
+                std::string_view key;
+                if (!nextKey(key) || key != "index") {
+                    fail("variant sem \"index\"");
+                }
+                const auto index = readNumber<size_t>();
+                if (index >= std::variant_size_v<Type>) {
+                    fail("índice de variant inválido");
+                }
+                if (!nextKey(key) || key != "value") {
+                    fail("variant sem \"value\"");
+                }
+                readVariant(v, index, std::make_index_sequence<std::variant_size_v<Type>>{});
+                if (nextKey(key)) {
+                    fail("variant com campos a mais");
+                }
+            } else if constexpr (detail::IsOptional<Type>::value) {
+                if (tryNull()) {
+                    v.reset();
+                } else {
+                    if (!v) adopt(v.emplace());
+                    read(*v);
+                }
+            } else if constexpr (detail::IsSmartPointer<Type>::value) {
+                if (tryNull()) {
+                    v.reset();
+                } else {
+                    if (!v) {
+                        v.reset(new typename Type::element_type());
+                        adopt(*v);
+                    }
+                    read(*v);
+                }
+            } else if constexpr (detail::IsPair<Type>::value) {
+                beginArray();
+                readElement(v.first);
+                readElement(v.second);
+                endFixedArray();
+            } else if constexpr (detail::IsTuple<Type>::value) {
+                beginArray();
+                std::apply([this](auto&... items) { (readElement(items), ...); }, v);
+                endFixedArray();
+            } else if constexpr (detail::IsStdArray<Type>::value) {
+                beginArray();
+                for (auto& item : v) {
+                    readElement(item);
+                }
+                endFixedArray();
+            } else if constexpr (detail::MapLike<Type>) {
+                v.clear();
+                if constexpr (detail::StringLike<typename Type::key_type> &&
+                              !std::is_pointer_v<typename Type::key_type>) {
+                    beginObject();
+                    std::string_view key;
+                    while (nextKey(key)) {
+                        auto& item = v[detail::makeElementFor<typename Type::key_type>(v, key)];
+                        adopt(item);
+                        read(item);
+                    }
+                } else {
+                    // Chaves não-string chegam como array de pares [chave, valor]
+                    beginArray();
+                    while (nextElement()) {
+                        auto entry = detail::makeElementFor<
+                            std::pair<typename Type::key_type, typename Type::mapped_type>>(v);
+                        adopt(entry.first);
+                        adopt(entry.second);
+                        read(entry);
+                        v.insert(std::move(entry));
+                    }
+                }
+            } else if constexpr (detail::SetLike<Type>) {
+                v.clear();
+                beginArray();
+                while (nextElement()) {
+                    auto item = detail::makeElementFor<typename Type::value_type>(v);
+                    adopt(item);
+                    read(item);
+                    v.insert(std::move(item));
+                }
+            } else if constexpr (detail::IsBoolVector<Type>::value) {
+                v.clear();
+                beginArray();
+                while (nextElement()) {
+                    v.push_back(readBool());
+                }
+            } else if constexpr (detail::ReusableSequence<Type>) {
+                // Sobrescreve os elementos que já existem (mantendo a memória deles) e só acrescenta o que faltar
+                beginArray();
+                size_t count = 0;
+                while (nextElement()) {
+                    if (count < v.size()) {
+                        read(v[count]);
+                    } else {
+                        auto& item = v.emplace_back();
+                        adopt(item);
+                        read(item);
+                    }
+                    ++count;
+                }
+                v.erase(v.begin() + count, v.end());
+            } else if constexpr (detail::SequenceLike<Type>) {
+                v.clear();
+                beginArray();
+                while (nextElement()) {
+                    auto& item = v.emplace_back();
+                    adopt(item);
+                    read(item);
+                }
+            } else {
+                static_assert(detail::AlwaysFalse<Type>, "Tipo não suportado pelo JsonReader");
+            }
+        }
+
+        [[nodiscard]] std::pmr::memory_resource* resource() const { return resource_; }
+
+        // Garante que não sobrou nada além de espaços depois do documento
+        void finish() {
+            skipWhitespace();
+            if (pos_ != input_.size()) {
+                fail("conteúdo extra após o fim do JSON");
+            }
+        }
+
+        [[nodiscard]] size_t position() const { return pos_; }
+
+        /**
+         * Confere que todos os campos do objeto lido apareceram (o readJson gerado marca um bit por campo)
+         * @param seen Bits dos campos encontrados, 64 por palavra, na ordem de names
+         * @param names Nomes dos campos, para a mensagem de erro
+         */
+        void requireFields(const uint64_t* seen, std::initializer_list<std::string_view> names) const {
+            size_t i = 0;
+            for (const auto name : names) {
+                if ((seen[i / 64] & (uint64_t{1} << (i % 64))) == 0) {
+                    fail("campo obrigatório ausente: " + std::string(name));
+                }
+                ++i;
+            }
+        }
+
+    private:
+        static bool isNumberChar(char c) {
+            return (c >= '0' && c <= '9') || c == '-' || c == '+' ||
+                   c == '.' || c == 'e' || c == 'E';
+        }
+
+        [[noreturn]] void fail(const std::string& message) const {
+            throw JsonParseError(message, pos_);
+        }
+
+        void skipWhitespace() {
+            while (pos_ < input_.size()) {
+                const char c = input_[pos_];
+                if (c != ' ' && c != '\n' && c != '\r' && c != '\t') break;
+                ++pos_;
+            }
+        }
+
+        [[nodiscard]] char peek() const {
+            return pos_ < input_.size() ? input_[pos_] : '\0';
+        }
+
+        void enter() {
+            first_ = true;
+            if (++depth_ > MAX_DEPTH) {
+                fail("JSON aninhado demais");
+            }
+        }
+
+        void expect(char c) {
+            skipWhitespace();
+            if (peek() != c) {
+                fail(std::string("esperado '") + c + "'");
+            }
+            ++pos_;
+        }
+
+        template<typename T>
+        void readElement(T& item) {
+            if (!nextElement()) {
+                fail("array com elementos a menos");
+            }
+            read(item);
+        }
+
+        void endFixedArray() {
+            if (nextElement()) {
+                fail("array com elementos a mais");
+            }
+        }
+
+        // Continua a decodificação de uma string a partir do primeiro '\'
+        void decodeEscapedTail() {
+            while (pos_ < input_.size()) {
+                const char c = input_[pos_++];
+                if (c == '"') {
+                    return;
+                }
+                if (c != '\\') {
+                    scratch_.push_back(c);
+                    continue;
+                }
+                if (pos_ >= input_.size()) break;
+
+                switch (input_[pos_++]) {
+                    case '"':  scratch_.push_back('"'); break;
+                    case '\\': scratch_.push_back('\\'); break;
+                    case '/':  scratch_.push_back('/'); break;
+                    case 'b':  scratch_.push_back('\b'); break;
+                    case 'f':  scratch_.push_back('\f'); break;
+                    case 'n':  scratch_.push_back('\n'); break;
+                    case 'r':  scratch_.push_back('\r'); break;
+                    case 't':  scratch_.push_back('\t'); break;
+                    case 'u': {
+                        uint32_t codepoint = readHex4();
+                        // Par substituto UTF-16: alto (D800-DBFF) seguido de baixo (DC00-DFFF)
+                        if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+                            if (input_.substr(pos_, 2) != "\\u") {
+                                fail("substituto UTF-16 sem par");
+                            }
+                            pos_ += 2;
+                            const uint32_t low = readHex4();
+                            if (low < 0xDC00 || low > 0xDFFF) {
+                                fail("substituto UTF-16 sem par");
+                            }
+                            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                        } else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+                            fail("substituto UTF-16 sem par");
+                        }
+                        appendUtf8(codepoint);
+                        break;
+                    }
+                    default:
+                        --pos_;
+                        fail("escape inválido");
+                }
+            }
+            fail("string não terminada");
+        }
+
+        uint32_t readHex4() {
+            if (pos_ + 4 > input_.size()) {
+                fail("escape \\u incompleto");
+            }
+            uint32_t value = 0;
+            auto [ptr, ec] = std::from_chars(input_.data() + pos_, input_.data() + pos_ + 4, value, 16);
+            if (ec != std::errc() || ptr != input_.data() + pos_ + 4) {
+                fail("escape \\u inválido");
+            }
+            pos_ += 4;
+            return value;
+        }
+
+        void appendUtf8(uint32_t codepoint) {
+            if (codepoint < 0x80) {
+                scratch_.push_back(static_cast<char>(codepoint));
+            } else if (codepoint < 0x800) {
+                scratch_.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+                scratch_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+            } else if (codepoint < 0x10000) {
+                scratch_.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+                scratch_.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+                scratch_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+            } else {
+                scratch_.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+                scratch_.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+                scratch_.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+                scratch_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+            }
+        }
+
+        // Troca a alternativa só se ela mudou: a mesma alternativa mantém a memória dela
+        template<typename V, size_t... I>
+        void readVariant(V& v, size_t index, std::index_sequence<I...>) {
+            ((index == I ? (readAlternative<I>(v), true) : false) || ...);
+        }
+
+        template<size_t I, typename V>
+        void readAlternative(V& v) {
+            if (v.index() != I) {
+                adopt(v.template emplace<I>());
+            }
+            read(std::get<I>(v));
+        }
+
+        // Objeto recém-criado pelo reader passa a usar o memory_resource da leitura
+        template<typename T>
+        void adopt(T& item) {
+            if constexpr (detail::HasUseMemoryResource<T>) {
+                if (resource_) item.useMemoryResource(resource_);
+            }
+        }
+
+        std::string_view input_;
+        std::pmr::memory_resource* resource_ = nullptr;
+        size_t pos_ = 0;
+        bool first_ = false;
+        size_t depth_ = 0;
+        std::string scratch_;
+    };
+}
+
+#endif //CPP_SERIALIZER_JSONREADER_H
@@ -0,0 +1,357 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_JSONWRITER_H
+#define CPP_SERIALIZER_JSONWRITER_H
+
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+
+#include "TypeTraits.h"
+
+namespace serializer {
+    class JsonWriter;
+
+    namespace detail {
+        template<typename T>
+        concept HasSerializeTo = requires(const T& obj, JsonWriter& out) {
+            obj.serializeTo(out);
+        };
+
+        template<typename T>
+        concept HasSerializedJsonSize = requires(const T& obj) {
+            { obj.serializedJsonSize() } -> std::convertible_to<size_t>;
+        };
+
+        // Funções livres achadas por ADL (geradas no modo --non-intrusive)
+        template<typename T>
+        concept HasFreeSerializeTo = requires(const T& obj, JsonWriter& out) {
+            serializeTo(out, obj);
+        };
+
+        template<typename T>
+        concept HasFreeSerializedJsonSize = requires(const T& obj) {
+            { serializedJsonSize(obj) } -> std::convertible_to<size_t>;
+        };
+    }
+
+    /**
+     * Escritor JSON em streaming: anexa o texto direto num buffer de bytes,
+     * sem montar nenhum nlohmann::json intermediário.
+     *
+     * O buffer é do chamador e pode ser reutilizado entre mensagens
+     * (basta dar clear() — a capacidade é mantida).
+     */
+    class JsonWriter {
+    public:
+        explicit JsonWriter(std::string& out) : out_(out) {}
+
+        void beginObject() {
+            separate();
+            out_.push_back('{');
+            needComma_ = false;
+        }
+
+        void endObject() {
+            out_.push_back('}');
+            needComma_ = true;
+        }
+
+        void beginArray() {
+            separate();
+            out_.push_back('[');
+            needComma_ = false;
+        }
+
+        void endArray() {
+            out_.push_back(']');
+            needComma_ = true;
+        }
+
+        /**
+         * Escreve o nome de um campo. Os nomes vêm do gerador (identificadores
+         * C++), por isso não passam por escape.
+         */
+        void key(std::string_view name) {
+            separate();
+            out_.push_back('"');
+            out_.append(name);
+            out_.append("\":", 2);
+            needComma_ = false;
+        }
+
+        void null() {
+            separate();
+            out_.append("null", 4);
+            needComma_ = true;
+        }
+
+        void stringValue(std::string_view str) {
+            separate();
+            appendEscaped(str);
+            needComma_ = true;
+        }
+
+        template<typename T>
+        void value(const T& v) {
+            using Type = std::remove_cvref_t<T>;
+
+            if constexpr (detail::HasFreeSerializeTo<Type>) {
+                serializeTo(*this, v);
+            } else if constexpr (detail::HasSerializeTo<Type>) {
+                v.serializeTo(*this);
+            } else if constexpr (std::is_same_v<Type, bool>) {
+                separate();
+                if (v) out_.append("true", 4);
+                else out_.append("false", 5);
+                needComma_ = true;
+            } else if constexpr (std::is_integral_v<Type>) {
+                separate();
+                appendNumber(v);
+                needComma_ = true;
+            } else if constexpr (std::is_floating_point_v<Type>) {
+                separate();
+                appendFloat(v);
+                needComma_ = true;
+            } else if constexpr (std::is_enum_v<Type>) {
+                value(static_cast<std::underlying_type_t<Type>>(v));
+            } else if constexpr (detail::StringLike<Type>) {
+                stringValue(std::string_view(v));
+            } else if constexpr (detail::IsOptional<Type>::value) {
+                if (v) value(*v);
+                else null();
+            } else if constexpr (detail::IsSmartPointer<Type>::value || std::is_pointer_v<Type>) {
+                if (v) value(*v);
+                else null();
+            } else if constexpr (detail::IsWeakPointer<Type>::value) {
+                value(v.lock());
+            } else if constexpr (detail::IsPair<Type>::value) {
+                beginArray();
+                value(v.first);
+                value(v.second);
+                endArray();
+            } else if constexpr (detail::IsTuple<Type>::value) {
+                beginArray();
+                std::apply([this](const auto&... items) { (value(items), ...); }, v);
+                endArray();
+            } else if constexpr (detail::IsVariant<Type>::value) {
+                // {"index": i, "value": ...}: a alternativa não dá para deduzir do valor
+                // (variant<int, double>, variant<std::string, int> com "42"...)
+                beginObject();
+                key("index");
+                value(v.index());
+                key("value");
+                std::visit([this](const auto& item) { value(item); }, v);
+                endObject();
+            } else if constexpr (detail::MapLike<Type>) {
+                // Mesmo formato do nlohmann: chaves string viram objeto,
+                // demais chaves viram array de pares [chave, valor]
+                if constexpr (detail::StringLike<typename Type::key_type>) {
+                    beginObject();
+                    for (const auto& [k, item] : v) {
+                        separate();
+                        appendEscaped(std::string_view(k));
+                        out_.push_back(':');
+                        needComma_ = false;
+                        value(item);
+                    }
+                    endObject();
+                } else {
+                    beginArray();
+                    for (const auto& entry : v) {
+                        value(entry);
+                    }
+                    endArray();
+                }
+            } else if constexpr (detail::RangeLike<Type>) {
+                beginArray();
+                for (const auto& item : v) {
+                    value(item);
+                }
+                endArray();
+            } else {
+                static_assert(detail::AlwaysFalse<Type>, "Tipo não suportado pelo JsonWriter");
+            }
+        }
+
+        [[nodiscard]] std::string& buffer() { return out_; }
+
+        /**
+         * Limite superior do tamanho que value(v) vai escrever. É exato para
+         * tudo menos ponto flutuante, que conta a maior forma possível.
+         */
+        template<typename T>
+        [[nodiscard]] static size_t sizeBound(const T& v) {
+            using Type = std::remove_cvref_t<T>;
+
+            if constexpr (detail::HasFreeSerializeTo<Type> && detail::HasFreeSerializedJsonSize<Type>) {
+                return serializedJsonSize(v);
+            } else if constexpr (detail::HasSerializeTo<Type> && detail::HasSerializedJsonSize<Type>) {
+                return v.serializedJsonSize();
+            } else if constexpr (std::is_same_v<Type, bool>) {
+                return v ? 4 : 5;
+            } else if constexpr (std::is_integral_v<Type>) {
+                return integerSize(v);
+            } else if constexpr (std::is_same_v<Type, float>) {
+                return 16;   // "-1.17549435e-38"
+            } else if constexpr (std::is_same_v<Type, double>) {
+                return 26;   // "-2.2250738585072014e-308"
+            } else if constexpr (std::is_floating_point_v<Type>) {
+                return 48;
+            } else if constexpr (std::is_enum_v<Type>) {
+                return sizeBound(static_cast<std::underlying_type_t<Type>>(v));
+            } else if constexpr (detail::StringLike<Type>) {
+                return escapedSize(std::string_view(v));
+            } else if constexpr (detail::IsOptional<Type>::value ||
+                                 detail::IsSmartPointer<Type>::value ||
+                                 std::is_pointer_v<Type>) {
+                return v ? sizeBound(*v) : 4;
+            } else if constexpr (detail::IsWeakPointer<Type>::value) {
+                return sizeBound(v.lock());
+            } else if constexpr (detail::IsPair<Type>::value) {
+                return 3 + sizeBound(v.first) + sizeBound(v.second);
+            } else if constexpr (detail::IsTuple<Type>::value) {
+                constexpr size_t count = std::tuple_size_v<Type>;
+                return 2 + (count ? count - 1 : 0) +
+                       std::apply([](const auto&... items) { return (size_t{0} + ... + sizeBound(items)); }, v);
+            } else if constexpr (detail::IsVariant<Type>::value) {
+                // {"index":N,"value":...}
+                return 19 + integerSize(v.index()) + std::visit([](const auto& item) { return sizeBound(item); }, v);
+            } else if constexpr (detail::MapLike<Type>) {
+                size_t size = 2 + (v.empty() ? 0 : v.size() - 1);
+                for (const auto& [k, item] : v) {
+                    if constexpr (detail::StringLike<typename Type::key_type>) {
+                        size += escapedSize(std::string_view(k)) + 1 + sizeBound(item);
+                    } else {
+                        size += 3 + sizeBound(k) + sizeBound(item);
+                    }
+                }
+                return size;
+            } else if constexpr (detail::RangeLike<Type>) {
+                size_t size = 2;
+                size_t count = 0;
+                for (const auto& item : v) {
+                    size += sizeBound(item);
+                    ++count;
+                }
+                return size + (count ? count - 1 : 0);
+            } else {
+                static_assert(detail::AlwaysFalse<Type>, "Tipo não suportado pelo JsonWriter");
+            }
+        }
+
+    private:
+        template<typename T>
+        static size_t integerSize(T number) {
+            size_t size = 1;
+            std::make_unsigned_t<T> magnitude = static_cast<std::make_unsigned_t<T>>(number);
+            if constexpr (std::is_signed_v<T>) {
+                if (number < 0) {
+                    ++size;
+                    magnitude = static_cast<std::make_unsigned_t<T>>(0) - magnitude;
+                }
+            }
+            while (magnitude >= 10) {
+                magnitude /= 10;
+                ++size;
+            }
+            return size;
+        }
+
+        // Tamanho da string já com aspas e escapes
+        static size_t escapedSize(std::string_view str) {
+            size_t size = 2 + str.size();
+            for (const char ch : str) {
+                const auto c = static_cast<unsigned char>(ch);
+                if (c == '"' || c == '\\' || c == '\b' || c == '\f' ||
+                    c == '\n' || c == '\r' || c == '\t') {
+                    size += 1;
+                } else if (c < 0x20) {
+                    size += 5;
+                }
+            }
+            return size;
+        }
+
+        void separate() {
+            if (needComma_) {
+                out_.push_back(',');
+            }
+        }
+
+        template<typename T>
+        void appendNumber(T number) {
+            char digits[24];
+            auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), number);
+            out_.append(digits, end);
+        }
+
+        template<typename T>
+        void appendFloat(T number) {
+            // nlohmann serializa NaN/infinito como null
+            if (!std::isfinite(number)) {
+                out_.append("null", 4);
+                return;
+            }
+
+            char digits[64];
+            auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), number);
+            std::string_view text(digits, end - digits);
+            out_.append(text);
+
+            // Mantém o ponto decimal para não virar inteiro na volta (1.0, não 1)
+            if (text.find_first_of(".e") == std::string_view::npos) {
+                out_.append(".0", 2);
+            }
+        }
+
+        void appendEscaped(std::string_view str) {
+            static constexpr char HEX[] = "0123456789abcdef";
+
+            out_.push_back('"');
+
+            // Copia trechos sem escape de uma vez só
+            size_t runStart = 0;
+            for (size_t i = 0; i < str.size(); ++i) {
+                const auto c = static_cast<unsigned char>(str[i]);
+                if (c >= 0x20 && c != '"' && c != '\\') {
+                    continue;
+                }
+
+                out_.append(str.data() + runStart, i - runStart);
+                runStart = i + 1;
+
+                switch (c) {
+                    case '"':  out_.append("\\\"", 2); break;
+                    case '\\': out_.append("\\\\", 2); break;
+                    case '\b': out_.append("\\b", 2); break;
+                    case '\f': out_.append("\\f", 2); break;
+                    case '\n': out_.append("\\n", 2); break;
+                    case '\r': out_.append("\\r", 2); break;
+                    case '\t': out_.append("\\t", 2); break;
+                    default: {
+                        const char escaped[6] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xF]};
+                        out_.append(escaped, sizeof(escaped));
+                        break;
+                    }
+                }
+            }
+            out_.append(str.data() + runStart, str.size() - runStart);
+
+            out_.push_back('"');
+        }
+
+        std::string& out_;
+        bool needComma_ = false;
+    };
+}
+
+#endif //CPP_SERIALIZER_JSONWRITER_H
@@ -0,0 +1,88 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_LEXER_H
+#define CPP_SERIALIZER_LEXER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace serializer {
+    enum class TokenKind {
+        Identifier,     // nomes e palavras-chave
+        Number,         // 42, 0x1F, 1'000, 3.5e-2
+        Literal,        // "texto", 'c', R"(bruto)"
+        Punct,          // :: e demais caracteres isolados (>> são dois '>')
+        End             // fim do conteúdo
+    };
+
+    struct Token {
+        TokenKind kind = TokenKind::End;
+        std::string_view text;      // View para o conteúdo original, sem cópia
+        bool spaceBefore = false;   // Havia espaço ou comentário antes deste token?
+
+        [[nodiscard]] bool is(std::string_view s) const { return text == s; }
+        [[nodiscard]] bool is(char c) const { return text.size() == 1 && text[0] == c; }
+        [[nodiscard]] bool isIdentifier() const { return kind == TokenKind::Identifier; }
+        [[nodiscard]] bool isEnd() const { return kind == TokenKind::End; }
+    };
+
+    /**
+     * Lexer de C++ sobre std::string_view, sem alocação por token.
+     *
+     * Descarta espaços, comentários de linha e de bloco e diretivas de
+     * pré-processador (com continuação por '\'), então declarações quebradas
+     * em várias linhas chegam ao parser como uma sequência contínua. '>' é
+     * sempre um token próprio, para templates aninhados fecharem certo.
+     */
+    class Lexer {
+    public:
+        /**
+         * @param source Conteúdo a tokenizar (precisa viver mais que os tokens)
+         * @param offset Posição inicial (deve ser início de linha)
+         */
+        explicit Lexer(std::string_view source, size_t offset = 0);
+
+        // Consome e devolve o próximo token (inline: é chamado uma vez por token)
+        Token next() {
+            Token token = current_;
+            if (!token.isEnd()) {
+                consumedEnd_ = static_cast<size_t>(token.text.data() - source_.data()) + token.text.size();
+                current_ = scan();
+            }
+            return token;
+        }
+
+        // Próximo token, sem consumir
+        [[nodiscard]] const Token& peek() const { return current_; }
+
+        // Posição no conteúdo logo após o último token consumido
+        [[nodiscard]] size_t offset() const { return consumedEnd_; }
+
+        /**
+         * Acrescenta o token a out com espaçamento canônico: um espaço só entre
+         * duas palavras ("unsigned int") e depois de vírgula ("std::map<K, V>")
+         * @param out Texto sendo montado (ex: o tipo de um campo)
+         * @param previous Token anterior já acrescentado (nullptr no primeiro)
+         * @param token Token a acrescentar
+         */
+        static void appendSpelling(std::string& out, const Token* previous, const Token& token);
+
+    private:
+        Token scan();
+        bool skipTrivia();
+        void skipDirective();
+        size_t scanQuoted(size_t pos, char quote) const;
+        size_t scanRawString(size_t pos) const;
+
+        std::string_view source_;
+        size_t pos_ = 0;
+        size_t consumedEnd_ = 0;
+        bool atLineStart_ = true;
+        Token current_;
+    };
+}
+
+#endif //CPP_SERIALIZER_LEXER_H
@@ -8,4 +8,17 @@
 #define SERIALIZABLE(ClassName)
 #define TRANSIENT [[maybe_unused]]
 
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+
+// Declarações antecipadas usadas pelos métodos gerados
+namespace serializer {
+    class JsonWriter;
+    class JsonReader;
+    class WireWriter;
+    class WireReader;
+}
+
 #endif //CPP_SERIALIZER_MACRO_H
\ No newline at end of file
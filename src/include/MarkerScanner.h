@@ -0,0 +1,37 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_MARKERSCANNER_H
+#define CPP_SERIALIZER_MARKERSCANNER_H
+
+#include <cstddef>
+#include <string_view>
+
+namespace serializer {
+    /**
+     * Busca vetorizada de um marcador (ex: "SERIALIZABLE") no buffer inteiro.
+     *
+     * Compara o primeiro e o último caractere do marcador em blocos de 32
+     * (AVX2) ou 16 (SSE2) bytes por vez e só confirma com memcmp as posições
+     * em que os dois batem. Como quase nenhum header tem o marcador, a maioria
+     * dos arquivos é rejeitada sem ser quebrada em linhas. Sem SIMD cai no
+     * std::string_view::find.
+     */
+    class MarkerScanner {
+    public:
+        /**
+         * Procura needle em haystack a partir de from
+         * @param haystack Conteúdo do arquivo
+         * @param needle Marcador procurado
+         * @param from Posição inicial
+         * @return Posição da primeira ocorrência ou std::string_view::npos
+         */
+        [[nodiscard]] static size_t find(std::string_view haystack, std::string_view needle, size_t from = 0);
+
+        // Implementação escolhida para esta CPU ("avx2", "sse2" ou "scalar")
+        [[nodiscard]] static const char* implementation();
+    };
+}
+
+#endif //CPP_SERIALIZER_MARKERSCANNER_H
@@ -0,0 +1,42 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_OPTIONS_H
+#define CPP_SERIALIZER_OPTIONS_H
+
+#include <filesystem>
+#include <optional>
+
+#include "FileWalker.h"
+#include "Profiler.h"
+
+namespace serializer {
+    // Opções de linha de comando do cpp-serializer-gen
+    struct Options {
+        std::filesystem::path projectPath;
+        bool generatePmr = false;   // --pmr
+        bool nonIntrusive = false;  // --non-intrusive: só funções livres, headers intocados
+        bool outOfLine = false;     // --out-of-line: corpos num .cpp por classe
+        unsigned jobs = 1;          // --jobs N (0 = um por núcleo)
+        bool useCache = true;       // --no-cache desliga o cache do parse
+        bool watch = false;         // --watch: continua rodando e regera a cada mudança
+        WalkOptions walk;           // --ignore, --no-gitignore, --compile-commands
+        ProfileFormat profile = ProfileFormat::None;            // --profile[=table|json]
+        std::optional<std::filesystem::path> profileOutput;     // --profile-out ARQUIVO (padrão: stdout)
+        std::optional<std::filesystem::path> depfile;           // --depfile ARQUIVO: headers lidos (formato make)
+        std::optional<std::filesystem::path> manifest;          // --manifest ARQUIVO: header -> arquivos gerados (JSON)
+    };
+
+    /**
+     * Lê as opções da linha de comando ([opções] <caminho-do-projeto>)
+     * @param argc Quantidade de argumentos
+     * @param argv Argumentos
+     * @return Opções lidas ou std::nullopt (uso já impresso em std::cerr)
+     */
+    [[nodiscard]] std::optional<Options> parseOptions(int argc, char* argv[]);
+
+    void printUsage(const char* program);
+}
+
+#endif //CPP_SERIALIZER_OPTIONS_H
@@ -0,0 +1,94 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_PARSECACHE_H
+#define CPP_SERIALIZER_PARSECACHE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "ClassInfo.h"
+
+namespace serializer {
+    /**
+     * Cache persistente do resultado do parse, por header.
+     *
+     * Cada entrada guarda tamanho, data de modificação e hash do conteúdo do
+     * header, além do ClassInfo parseado. Se tamanho e data batem o arquivo
+     * nem é lido; se só a data mudou (touch, checkout) o hash decide. O
+     * arquivo inteiro é descartado quando a versão do gerador muda.
+     */
+    class ParseCache {
+    public:
+        // Incrementar sempre que o Parser ou o ClassInfo mudarem o que produzem
+        static constexpr std::string_view GENERATOR_VERSION = "cpp-serializer-gen/3";
+        static constexpr std::string_view FILE_NAME = ".cpp_serializer_cache";
+
+        struct Entry {
+            uint64_t size = 0;
+            int64_t modified = 0;              // last_write_time em ticks do file_clock
+            uint64_t hash = 0;                 // 0 = conteúdo ainda não lido
+            bool hasMacro = false;
+            std::optional<ClassInfo> classInfo;
+        };
+
+        explicit ParseCache(std::filesystem::path file) : file_(std::move(file)) {}
+
+        /**
+         * Carrega o cache do disco; arquivo ausente, corrompido ou de outra versão vira cache vazio
+         * @return true se alguma entrada foi carregada
+         */
+        bool load();
+
+        /**
+         * Grava o cache (arquivo temporário + rename, para nunca deixar um cache pela metade)
+         * @return false se não foi possível gravar
+         */
+        bool save();
+
+        /**
+         * Procura um header que não mudou desde a última execução
+         * @param header Caminho do header
+         * @param current Tamanho e data atuais (e o hash, se o conteúdo já foi lido)
+         * @return Entrada em cache ou nullptr se o header precisa ser parseado
+         */
+        [[nodiscard]] const Entry* find(const std::filesystem::path& header, const Entry& current) const;
+
+        void store(const std::filesystem::path& header, Entry entry);
+
+        // Remove as entradas de headers que não existem mais no projeto
+        template<typename Range>
+        void retainOnly(const Range& headers) {
+            std::unordered_map<std::string, Entry> kept;
+            for (const auto& header : headers) {
+                if (auto it = entries_.find(header.string()); it != entries_.end()) {
+                    kept.emplace(it->first, std::move(it->second));
+                }
+            }
+            entries_ = std::move(kept);
+        }
+
+        [[nodiscard]] size_t size() const { return entries_.size(); }
+
+        /**
+         * Lê tamanho e data de modificação do arquivo, sem abrir
+         * @return false se o arquivo não existe
+         */
+        static bool stamp(const std::filesystem::path& file, Entry& entry);
+
+        // FNV-1a de 64 bits: estável entre execuções e plataformas
+        [[nodiscard]] static uint64_t hashContent(std::string_view content);
+
+    private:
+        std::filesystem::path file_;
+        std::unordered_map<std::string, Entry> entries_;
+        int64_t savedAt_ = 0;                  // Quando o cache carregado foi gravado
+    };
+}
+
+#endif //CPP_SERIALIZER_PARSECACHE_H
@@ -10,6 +10,7 @@
 #include <filesystem>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace serializer {
@@ -24,6 +25,17 @@ namespace serializer {
             const std::filesystem::path& filePath
         ) const;
 
+        /**
+         * Parseia uma classe a partir do conteúdo já carregado (sem reler o arquivo)
+         * @param filePath Caminho do arquivo (gravado em ClassInfo::sourceFile)
+         * @param content Conteúdo do arquivo (ex: SourceFile::content())
+         * @return Informações da classe ou std::nullopt se não encontrar SERIALIZABLE
+         */
+        [[nodiscard]] std::optional<ClassInfo> parseClass(
+            const std::filesystem::path& filePath,
+            std::string_view content
+        ) const;
+
         /**
          * Parseia uma classe e analisa suas dependências
          * @param filePath Caminho do arquivo
@@ -35,6 +47,16 @@ namespace serializer {
             TypeChecker& typeChecker
         ) const;
 
+        /**
+         * Preenche as dependências de uma classe já parseada (sem reler o arquivo)
+         * @param classInfo Classe a analisar
+         * @param typeChecker TypeChecker com todas as classes registradas
+         */
+        void analyzeDependencies(
+            ClassInfo& classInfo,
+            const TypeChecker& typeChecker
+        ) const;
+
         /**
          * Parseia múltiplas classes de um arquivo (para classes aninhadas)
          * @param filePath Caminho do arquivo
@@ -62,6 +84,15 @@ namespace serializer {
             const std::filesystem::path& filePath
         ) const;
 
+        /**
+         * Verifica se o conteúdo contém a macro SERIALIZABLE fora de comentário de linha
+         * @param content Conteúdo do arquivo
+         * @return true se contém SERIALIZABLE
+         */
+        [[nodiscard]] bool containsSerializableMacro(
+            std::string_view content
+        ) const;
+
         /**
          * Extrai informações de template de um tipo
          * @param typeName Nome do tipo (ex: "std::vector<Usuario>")
@@ -72,21 +103,11 @@ namespace serializer {
 
     private:
         // Funções auxiliares internas
-        [[nodiscard]] AccessSpecifier currentAccessFromLine(const std::string& line) const;
-        [[nodiscard]] bool containsTransient(const std::string& line) const;
-        [[nodiscard]] std::optional<FieldInfo> parseFieldLine(
-            const std::string& line,
-            AccessSpecifier currentAccess
-        ) const;
-
         [[nodiscard]] std::optional<BaseClassInfo> parseBaseClass(
             const std::string& line
         ) const;
 
         [[nodiscard]] std::string readFile(const std::filesystem::path& filePath) const;
-        [[nodiscard]] std::vector<std::string> splitLines(const std::string& content) const;
-        [[nodiscard]] std::string removeComments(std::string line) const;
-        [[nodiscard]] static std::string trim(const std::string& str);
 
         // Análise de dependências
         void analyzeFieldDependencies(
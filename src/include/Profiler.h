@@ -0,0 +1,132 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_PROFILER_H
+#define CPP_SERIALIZER_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace serializer {
+    // Formato do relatório do --profile
+    enum class ProfileFormat {
+        None,   // Sem perfil
+        Table,  // --profile ou --profile=table
+        Json    // --profile=json (uma linha, para CI)
+    };
+
+    /**
+     * Tempos por fase e contadores de uma execução do gerador (--profile).
+     *
+     * Fases e contadores são atômicos: as tarefas do WorkStealingPool somam
+     * neles direto. As fases marcadas como "soma das threads" (leitura, busca
+     * da macro e parse) acumulam o tempo de todas as threads; as demais são
+     * tempo de relógio. Desligado, time() nem lê o relógio.
+     */
+    class Profiler {
+    public:
+        enum class Phase {
+            Walk,           // Busca de headers (FileWalker)
+            Headers,        // Leitura + busca da macro + parse (paralelo, relógio)
+            Read,           // stamp, abertura e hash dos headers (soma das threads)
+            Scan,           // Busca da macro SERIALIZABLE (soma das threads)
+            Parse,          // Parser::parseClass (soma das threads)
+            Register,       // Registro no TypeChecker e na tabela de classes
+            Dependencies,   // analyzeDependencies + grafo (Tarjan)
+            Sort,           // Ordenação topológica
+            Generate,       // Geração e escrita dos arquivos
+            Cache,          // Gravação do cache do parse
+            Count
+        };
+
+        enum class Counter {
+            EntriesVisited,     // Arquivos e diretórios vistos pelo FileWalker
+            DirectoriesSkipped, // Diretórios podados (lista fixa, --ignore, .gitignore)
+            HeadersFound,
+            HeadersFromCache,   // Reaproveitados do cache sem parse
+            BytesRead,          // Headers lidos para análise + leituras do gerador
+            ClassesParsed,
+            AnalyzeTypeCalls,
+            AnalyzeTypeCacheHits,
+            FilesWritten,
+            FilesUnchanged,     // Conteúdo igual ao existente: não reescritos
+            BytesWritten,
+            Count
+        };
+
+        using Clock = std::chrono::steady_clock;
+
+        // Soma o tempo do escopo na fase ao ser destruído
+        class Timer {
+        public:
+            Timer(Profiler* profiler, Phase phase)
+                : profiler_(profiler), phase_(phase), start_(profiler ? Clock::now() : Clock::time_point()) {}
+            ~Timer() { stop(); }
+
+            // Encerra antes do fim do escopo (só a primeira chamada conta)
+            void stop() {
+                if (profiler_) profiler_->addTime(phase_, Clock::now() - start_);
+                profiler_ = nullptr;
+            }
+
+            Timer(const Timer&) = delete;
+            Timer& operator=(const Timer&) = delete;
+
+        private:
+            Profiler* profiler_;
+            Phase phase_;
+            Clock::time_point start_;
+        };
+
+        explicit Profiler(ProfileFormat format = ProfileFormat::None) : format_(format) {}
+
+        [[nodiscard]] bool enabled() const { return format_ != ProfileFormat::None; }
+
+        // Mede o escopo: auto timer = profiler.time(Profiler::Phase::Walk);
+        [[nodiscard]] Timer time(Phase phase) { return {enabled() ? this : nullptr, phase}; }
+
+        void addTime(Phase phase, Clock::duration elapsed) {
+            phases_[index(phase)].fetch_add(elapsed.count(), std::memory_order_relaxed);
+        }
+
+        void add(Counter counter, uint64_t value = 1) {
+            if (enabled()) counters_[index(counter)].fetch_add(value, std::memory_order_relaxed);
+        }
+
+        void set(Counter counter, uint64_t value) {
+            counters_[index(counter)].store(value, std::memory_order_relaxed);
+        }
+
+        // Zera tudo (o --watch mede cada rodada separadamente)
+        void reset();
+
+        /**
+         * Escreve o relatório no formato escolhido
+         * @param out Destino (std::cout ou arquivo do --profile-out)
+         */
+        void report(std::ostream& out) const;
+
+        [[nodiscard]] std::string toJson() const;
+
+        [[nodiscard]] static const char* name(Phase phase);
+        [[nodiscard]] static const char* name(Counter counter);
+
+    private:
+        template<typename E>
+        static constexpr size_t index(E e) { return static_cast<size_t>(e); }
+
+        [[nodiscard]] double milliseconds(Phase phase) const;
+        void reportTable(std::ostream& out) const;
+
+        ProfileFormat format_;
+        std::array<std::atomic<Clock::rep>, static_cast<size_t>(Phase::Count)> phases_{};
+        std::array<std::atomic<uint64_t>, static_cast<size_t>(Counter::Count)> counters_{};
+    };
+}
+
+#endif //CPP_SERIALIZER_PROFILER_H
@@ -0,0 +1,398 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_RECORDSTREAM_H
+#define CPP_SERIALIZER_RECORDSTREAM_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "JsonReader.h"
+#include "JsonWriter.h"
+#include "WireFormat.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CPP_SERIALIZER_HAS_FD_IO 1
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+/*
+ * Sequências de registros sem montar o vector nem o array inteiro:
+ *
+ *  - NDJSON ........... um objeto JSON por linha, terminado em '\n' (o JsonWriter
+ *                       escapa quebras de linha dentro das strings)
+ *  - LengthPrefixed ... varint(tamanho) + registro no formato do WireFormat.h
+ *
+ * StreamWriter<T> e StreamReader<T> funcionam com qualquer classe gerada
+ * (modo membro ou --non-intrusive) e escrevem/leem num std::ostream/istream
+ * ou num file descriptor, através de um buffer de tamanho fixo: a memória
+ * fica em buffer + maior registro, seja qual for o tamanho do fluxo.
+ */
+namespace serializer {
+    enum class RecordFormat {
+        NdJson,
+        LengthPrefixed
+    };
+
+    // Erro de E/S, registro maior que o limite ou fluxo cortado no meio de um registro
+    class RecordStreamError : public std::runtime_error {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * Escreve registros um a um. Os bytes se acumulam no buffer e vão para o
+     * destino quando ele enche, em flush() ou no destrutor.
+     */
+    template<typename T>
+    class StreamWriter {
+    public:
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+        explicit StreamWriter(std::ostream& out, RecordFormat format = RecordFormat::NdJson,
+                              size_t bufferSize = DEFAULT_BUFFER_SIZE)
+            : stream_(&out), format_(format), bufferSize_(bufferSize) {
+            buffer_.reserve(bufferSize_);
+        }
+
+#ifdef CPP_SERIALIZER_HAS_FD_IO
+        // O descritor continua sendo do chamador (não é fechado)
+        explicit StreamWriter(int fd, RecordFormat format = RecordFormat::NdJson,
+                              size_t bufferSize = DEFAULT_BUFFER_SIZE)
+            : fd_(fd), format_(format), bufferSize_(bufferSize) {
+            buffer_.reserve(bufferSize_);
+        }
+#endif
+
+        // Erros do último flush se perdem aqui: chame flush() antes para tratá-los
+        ~StreamWriter() {
+            try {
+                flush();
+            } catch (...) {
+            }
+        }
+
+        StreamWriter(const StreamWriter&) = delete;
+        StreamWriter& operator=(const StreamWriter&) = delete;
+
+        void write(const T& record) {
+            if (format_ == RecordFormat::NdJson) {
+                JsonWriter writer(buffer_);
+                writer.value(record);
+                buffer_.push_back('\n');
+            } else {
+                WireWriter writer(buffer_);
+                writer.varint(WireWriter::sizeOf(record));
+                writer.value(record);
+            }
+            ++count_;
+
+            if (buffer_.size() >= bufferSize_) {
+                flush();
+            }
+        }
+
+        void flush() {
+            writeBytes(buffer_.data(), buffer_.size());
+            buffer_.clear();
+
+            // Um registro enorme fez o buffer crescer: devolve a memória
+            if (buffer_.capacity() > 2 * bufferSize_) {
+                std::string().swap(buffer_);
+                buffer_.reserve(bufferSize_);
+            }
+            if (stream_ && !stream_->flush()) {
+                throw RecordStreamError("falha ao gravar no stream");
+            }
+        }
+
+        // Registros escritos até agora
+        [[nodiscard]] uint64_t count() const { return count_; }
+
+    private:
+        void writeBytes(const char* data, size_t size) {
+            if (stream_) {
+                if (!stream_->write(data, static_cast<std::streamsize>(size))) {
+                    throw RecordStreamError("falha ao gravar no stream");
+                }
+                return;
+            }
+#ifdef CPP_SERIALIZER_HAS_FD_IO
+            while (size > 0) {
+                const ssize_t written = ::write(fd_, data, size);
+                if (written < 0) {
+                    if (errno == EINTR) continue;
+                    throw RecordStreamError(std::string("falha ao gravar: ") + std::strerror(errno));
+                }
+                data += written;
+                size -= static_cast<size_t>(written);
+            }
+#endif
+        }
+
+        std::ostream* stream_ = nullptr;
+        int fd_ = -1;
+        RecordFormat format_;
+        size_t bufferSize_;
+        std::string buffer_;
+        uint64_t count_ = 0;
+    };
+
+    /**
+     * Lê registros um a um, com next() ou com range-for:
+     *
+     *     StreamReader<Pedido> reader(arquivo);
+     *     for (const Pedido& pedido : reader) { ... }
+     *
+     * Cada registro é lido sobre o anterior, reaproveitando a memória dos
+     * campos; uma linha NDJSON sem algum campo lança JsonParseError.
+     *
+     * Com std::istream, cada leitura pega o que o streambuf já tem e só
+     * bloqueia quando não há nada: pipes e sockets entregam cada registro
+     * assim que ele chega, sem esperar o buffer encher.
+     */
+    template<typename T>
+    class StreamReader {
+    public:
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+        static constexpr size_t DEFAULT_MAX_RECORD_SIZE = 64 * 1024 * 1024;
+
+        /**
+         * @param in Origem dos registros
+         * @param format Formato dos registros
+         * @param bufferSize Tamanho do buffer de leitura
+         * @param maxRecordSize Maior registro aceito (o buffer só cresce até ele)
+         */
+        explicit StreamReader(std::istream& in, RecordFormat format = RecordFormat::NdJson,
+                              size_t bufferSize = DEFAULT_BUFFER_SIZE,
+                              size_t maxRecordSize = DEFAULT_MAX_RECORD_SIZE)
+            : stream_(&in), format_(format), bufferSize_(bufferSize), maxRecordSize_(maxRecordSize) {
+            buffer_.resize(bufferSize_);
+        }
+
+#ifdef CPP_SERIALIZER_HAS_FD_IO
+        // O descritor continua sendo do chamador (não é fechado)
+        explicit StreamReader(int fd, RecordFormat format = RecordFormat::NdJson,
+                              size_t bufferSize = DEFAULT_BUFFER_SIZE,
+                              size_t maxRecordSize = DEFAULT_MAX_RECORD_SIZE)
+            : fd_(fd), format_(format), bufferSize_(bufferSize), maxRecordSize_(maxRecordSize) {
+            buffer_.resize(bufferSize_);
+        }
+#endif
+
+        StreamReader(const StreamReader&) = delete;
+        StreamReader& operator=(const StreamReader&) = delete;
+
+        /**
+         * Lê o próximo registro
+         * @param record Recebe o registro (a memória dos campos é reaproveitada)
+         * @return false no fim do fluxo
+         */
+        bool next(T& record) {
+            const bool found = format_ == RecordFormat::NdJson ? nextLine(record) : nextPrefixed(record);
+            if (found) ++count_;
+            return found;
+        }
+
+        // Registros lidos até agora
+        [[nodiscard]] uint64_t count() const { return count_; }
+
+        // Iterador de entrada: uma passada só, sobre o registro atual do reader
+        class iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using reference = const T&;
+            using pointer = const T*;
+
+            iterator() = default;
+
+            explicit iterator(StreamReader* reader) : reader_(reader) {
+                ++*this;
+            }
+
+            reference operator*() const { return reader_->current_; }
+            pointer operator->() const { return &reader_->current_; }
+
+            iterator& operator++() {
+                if (!reader_->next(reader_->current_)) reader_ = nullptr;
+                return *this;
+            }
+
+            void operator++(int) { ++*this; }
+
+            bool operator==(std::default_sentinel_t) const { return reader_ == nullptr; }
+
+        private:
+            StreamReader* reader_ = nullptr;
+        };
+
+        iterator begin() { return iterator(this); }
+        std::default_sentinel_t end() { return {}; }
+
+    private:
+        bool nextLine(T& record) {
+            while (true) {
+                // Procura o '\n' só nos bytes novos a cada leitura
+                size_t scanned = 0;
+                const char* newline = nullptr;
+                while (!(newline = static_cast<const char*>(
+                             std::memchr(buffer_.data() + begin_ + scanned, '\n', end_ - begin_ - scanned)))) {
+                    scanned = end_ - begin_;
+                    if (eof_) break;
+                    if (scanned >= maxRecordSize_) {
+                        throw RecordStreamError("registro maior que o limite de " + std::to_string(maxRecordSize_) + " bytes");
+                    }
+                    readMore(scanned + 1);
+                }
+
+                const size_t lineEnd = newline ? static_cast<size_t>(newline - buffer_.data()) : end_;
+                if (!newline && begin_ == end_) {
+                    return false;
+                }
+
+                const std::string_view line(buffer_.data() + begin_, lineEnd - begin_);
+                begin_ = newline ? lineEnd + 1 : end_;
+
+                // Linhas em branco (inclusive um "\r" sozinho) não são registros
+                if (line.find_first_not_of(" \t\r") == std::string_view::npos) {
+                    continue;
+                }
+
+                JsonReader in(line);
+                in.read(record);
+                in.finish();
+                return true;
+            }
+        }
+
+        bool nextPrefixed(T& record) {
+            // Fim limpo: nenhum byte depois do último registro
+            if (!fill(1)) {
+                return false;
+            }
+
+            uint64_t size = 0;
+            size_t prefix = 0;
+            for (int shift = 0;; shift += 7) {
+                if (shift > 63) {
+                    throw WireFormatError("varint longo demais");
+                }
+                if (!fill(prefix + 1)) {
+                    throw RecordStreamError("fluxo terminou no meio de um registro");
+                }
+                const auto byte = static_cast<uint8_t>(buffer_[begin_ + prefix++]);
+                if (shift == 63 && (byte & 0x7E)) {
+                    throw WireFormatError("varint inválido");   // O décimo byte só carrega o bit 63
+                }
+                size |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) break;
+            }
+
+            if (size > maxRecordSize_) {
+                throw RecordStreamError("registro maior que o limite de " + std::to_string(maxRecordSize_) + " bytes");
+            }
+            if (!fill(prefix + size)) {
+                throw RecordStreamError("fluxo terminou no meio de um registro");
+            }
+
+            WireReader in(std::string_view(buffer_.data() + begin_ + prefix, size));
+            in.read(record);
+            in.finish();
+            begin_ += prefix + size;
+            return true;
+        }
+
+        // Garante `size` bytes disponíveis a partir de begin_ (false se o fluxo acabar antes)
+        bool fill(size_t size) {
+            while (end_ - begin_ < size) {
+                if (eof_) return false;
+                readMore(size);
+            }
+            return true;
+        }
+
+        // Move o que sobrou para o início, cresce se `needed` não cabe e lê mais um bloco
+        void readMore(size_t needed) {
+            if (begin_ > 0) {
+                std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+                end_ -= begin_;
+                begin_ = 0;
+            }
+
+            if (needed > buffer_.size()) {
+                buffer_.resize(std::max(needed, std::min(2 * buffer_.size(), maxRecordSize_ + 16)));
+            } else if (end_ == 0 && buffer_.size() > bufferSize_) {
+                // O registro grande já passou: volta ao tamanho normal
+                buffer_.resize(bufferSize_);
+                buffer_.shrink_to_fit();
+            }
+
+            const size_t read = readSome(buffer_.data() + end_, buffer_.size() - end_);
+            if (read == 0) {
+                eof_ = true;
+            }
+            end_ += read;
+        }
+
+        size_t readSome(char* data, size_t size) {
+            if (stream_) {
+                // istream::read só volta com o buffer cheio: num pipe ou socket o registro que
+                // já chegou ficaria preso. Lê o que o streambuf tem e só bloqueia se não houver nada
+                std::streambuf* source = stream_->rdbuf();
+                if (!source) {
+                    throw RecordStreamError("falha ao ler do stream");
+                }
+                std::streamsize available = source->in_avail();
+                if (available == 0) {
+                    if (std::char_traits<char>::eq_int_type(source->sgetc(), std::char_traits<char>::eof())) {
+                        available = -1;
+                    } else {
+                        available = std::max<std::streamsize>(source->in_avail(), 1);
+                    }
+                }
+                if (available < 0) {
+                    stream_->setstate(std::ios::eofbit);
+                    return 0;
+                }
+                return static_cast<size_t>(
+                    source->sgetn(data, std::min(static_cast<std::streamsize>(size), available)));
+            }
+#ifdef CPP_SERIALIZER_HAS_FD_IO
+            while (true) {
+                const ssize_t read = ::read(fd_, data, size);
+                if (read >= 0) return static_cast<size_t>(read);
+                if (errno != EINTR) {
+                    throw RecordStreamError(std::string("falha ao ler: ") + std::strerror(errno));
+                }
+            }
+#else
+            return 0;
+#endif
+        }
+
+        std::istream* stream_ = nullptr;
+        int fd_ = -1;
+        RecordFormat format_;
+        size_t bufferSize_;
+        size_t maxRecordSize_;
+        std::string buffer_;    // Bytes válidos em [begin_, end_)
+        size_t begin_ = 0;
+        size_t end_ = 0;
+        bool eof_ = false;
+        uint64_t count_ = 0;
+        T current_{};           // Registro atual da iteração
+    };
+}
+
+#endif //CPP_SERIALIZER_RECORDSTREAM_H
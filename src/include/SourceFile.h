@@ -0,0 +1,56 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_SOURCEFILE_H
+#define CPP_SERIALIZER_SOURCEFILE_H
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace serializer {
+    /**
+     * Conteúdo de um arquivo fonte lido uma única vez.
+     *
+     * Arquivos grandes são mapeados com mmap (sem cópia para o processo);
+     * os pequenos vão num único read() para um buffer, que sai mais barato
+     * que montar e desmontar o mapeamento. Detecção da macro, parse e análise
+     * de dependências trabalham todos sobre o mesmo content().
+     */
+    class SourceFile {
+    public:
+        /**
+         * Abre e carrega o arquivo
+         * @param filePath Caminho do arquivo
+         * @return Arquivo carregado ou std::nullopt se não foi possível ler
+         */
+        [[nodiscard]] static std::optional<SourceFile> open(const std::filesystem::path& filePath);
+
+        SourceFile(const SourceFile&) = delete;
+        SourceFile& operator=(const SourceFile&) = delete;
+        SourceFile(SourceFile&& other) noexcept;
+        SourceFile& operator=(SourceFile&& other) noexcept;
+        ~SourceFile();
+
+        [[nodiscard]] std::string_view content() const {
+            return mapped_ ? std::string_view(mapped_, mappedSize_) : std::string_view(buffer_);
+        }
+
+        [[nodiscard]] const std::filesystem::path& path() const { return path_; }
+        [[nodiscard]] bool isMapped() const { return mapped_ != nullptr; }
+
+    private:
+        SourceFile() = default;
+        void release();
+
+        std::filesystem::path path_;
+        std::string buffer_;          // Arquivos pequenos (ou sem mmap disponível)
+        const char* mapped_ = nullptr;
+        size_t mappedSize_ = 0;
+    };
+}
+
+#endif //CPP_SERIALIZER_SOURCEFILE_H
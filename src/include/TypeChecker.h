@@ -7,12 +7,16 @@
 // TypeChecker.h - nova versão
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
 #include <string>
 #include <unordered_set>
 #include <vector>
 #include <filesystem>
 #include <unordered_map>
 #include "ClassInfo.h"
+#include "ClassTable.h"
 
 namespace serializer {
     class TypeChecker {
@@ -35,17 +39,35 @@ namespace serializer {
             bool isRecursive = false;  // Pode causar recursão infinita?
         };
 
+        // Chamadas de analyzeType e quantas vieram do cache (--profile)
+        struct Stats {
+            uint64_t analyzeTypeCalls = 0;
+            uint64_t cacheHits = 0;
+        };
+
+        // Memoizada pelo tipo normalizado; pode ser chamada de várias threads
         TypeAnalysis analyzeType(const std::string& typeName) const;
+        [[nodiscard]] Stats stats() const;
+        void resetStats();
         bool isSerializableType(const std::string& typeName) const;
         bool isSerializableClass(const std::string& className) const;
 
         // Registra classes serializáveis conhecidas
         void registerSerializableClass(const ClassInfo& classInfo);
+        void unregisterSerializableClass(const std::string& className);
         void clearRegisteredClasses();
 
-        // Detecção de ciclos
-        bool hasCircularDependency(const std::string& className,
-                                  int maxDepth = 4) const;
+        /**
+         * Analisa o grafo de dependências numa única passada (Tarjan, componentes
+         * fortemente conexas): marca hasCircularDependency em toda classe que está
+         * num ciclo (inclusive auto-referência) e calcula maxNestingDepth
+         * (0 = nenhuma classe serializável aninhada; cada ciclo conta uma vez)
+         * @param classes Tabela com dependencies já calculadas; as classes recebem os resultados
+         */
+        void analyzeClassGraph(ClassTable& classes);
+
+        // Detecção de ciclos (resultado da última analyzeClassGraph)
+        bool hasCircularDependency(const std::string& className) const;
         std::pair<std::string, std::vector<std::string>> extractTemplateInfo(const std::string& typeName) const;
 
     private:
@@ -53,9 +75,17 @@ namespace serializer {
         std::unordered_set<std::string> stlTypes_;
         std::unordered_set<std::string> serializableClasses_;
         std::unordered_set<std::string> containerPatterns_;
-        std::unordered_map<std::string, ClassInfo> classRegistry_;
+        std::unordered_set<std::string> recursiveClasses_;
+
+        // Cache de analyzeType: depende das classes registradas, limpo a cada registro
+        mutable std::shared_mutex analysisMutex_;
+        mutable std::unordered_map<std::string, TypeAnalysis> analysisCache_;
+        mutable std::atomic<uint64_t> analyzeCalls_{0};
+        mutable std::atomic<uint64_t> analyzeHits_{0};
 
         void initializeTypes();
+        void invalidateAnalysis();
+        TypeAnalysis computeAnalysis(const std::string& cleaned) const;
     };
 }
 #endif //CPP_SERIALIZER_TYPECHECKER_H
\ No newline at end of file
@@ -0,0 +1,129 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_TYPETRAITS_H
+#define CPP_SERIALIZER_TYPETRAITS_H
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Traits compartilhados pelos writers/readers gerados (JSON e binário)
+namespace serializer::detail {
+    template<typename T>
+    concept StringLike = std::is_convertible_v<const T&, std::string_view>;
+
+    template<typename T>
+    concept MapLike = requires {
+        typename T::key_type;
+        typename T::mapped_type;
+    };
+
+    template<typename T>
+    concept SetLike = requires {
+        typename T::key_type;
+    } && !MapLike<T>;
+
+    template<typename T>
+    concept RangeLike = requires(const T& range) {
+        std::begin(range);
+        std::end(range);
+    };
+
+    template<typename T>
+    concept SequenceLike = requires(T& seq) {
+        seq.clear();
+        seq.emplace_back();
+        seq.back();
+    };
+
+    // Classe gerada com --pmr: repassa o memory_resource para os próprios campos
+    template<typename T>
+    concept HasUseMemoryResource = requires(T& obj, std::pmr::memory_resource* resource) {
+        obj.useMemoryResource(resource);
+    };
+
+    template<typename T>
+    concept HasReserve = requires(T& container, std::size_t n) {
+        container.reserve(n);
+    };
+
+    // Sequência indexável (vector, deque): a leitura sobrescreve os elementos existentes em vez de recriá-los
+    template<typename T>
+    concept ReusableSequence = SequenceLike<T> && std::ranges::random_access_range<T> &&
+                               requires(T& seq) { seq.erase(seq.begin(), seq.end()); };
+
+    template<typename T>
+    struct IsStdString : std::false_type {};
+    template<typename C, typename Tr, typename A>
+    struct IsStdString<std::basic_string<C, Tr, A>> : std::true_type {};
+
+    template<typename T>
+    struct IsStdArray : std::false_type {};
+    template<typename T, std::size_t N>
+    struct IsStdArray<std::array<T, N>> : std::true_type {};
+
+    template<typename T>
+    struct IsBoolVector : std::false_type {};
+    template<typename A>
+    struct IsBoolVector<std::vector<bool, A>> : std::true_type {};
+
+    template<typename T>
+    struct IsOptional : std::false_type {};
+    template<typename T>
+    struct IsOptional<std::optional<T>> : std::true_type {};
+
+    template<typename T>
+    struct IsSmartPointer : std::false_type {};
+    template<typename T, typename D>
+    struct IsSmartPointer<std::unique_ptr<T, D>> : std::true_type {};
+    template<typename T>
+    struct IsSmartPointer<std::shared_ptr<T>> : std::true_type {};
+
+    template<typename T>
+    struct IsWeakPointer : std::false_type {};
+    template<typename T>
+    struct IsWeakPointer<std::weak_ptr<T>> : std::true_type {};
+
+    template<typename T>
+    struct IsPair : std::false_type {};
+    template<typename A, typename B>
+    struct IsPair<std::pair<A, B>> : std::true_type {};
+
+    template<typename T>
+    struct IsTuple : std::false_type {};
+    template<typename... Ts>
+    struct IsTuple<std::tuple<Ts...>> : std::true_type {};
+
+    template<typename T>
+    struct IsVariant : std::false_type {};
+    template<typename... Ts>
+    struct IsVariant<std::variant<Ts...>> : std::true_type {};
+
+    template<typename>
+    inline constexpr bool AlwaysFalse = false;
+
+    /**
+     * Cria um temporário com o mesmo alocador do container de destino
+     * (construção uses-allocator), para que mover para dentro dele não copie.
+     * Para tipos que não usam alocador é só T(args...).
+     */
+    template<typename T, typename Container, typename... Args>
+    T makeElementFor(const Container& target, Args&&... args) {
+        return std::make_obj_using_allocator<T>(target.get_allocator(), std::forward<Args>(args)...);
+    }
+}
+
+#endif //CPP_SERIALIZER_TYPETRAITS_H
@@ -6,14 +6,15 @@
 #define CPP_SERIALIZER_UTILS_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace serializer {
     class Utils {
     public:
-        static std::string trim(const std::string& str);
-        static std::string removeComments(std::string line);
-        static std::pair<std::string, std::vector<std::string>> extractTemplateInfo(const std::string& typeName);
+        // View sem espaços e tabs nas pontas (não copia)
+        static std::string_view trim(std::string_view str);
+        static std::pair<std::string, std::vector<std::string>> extractTemplateInfo(std::string_view typeName);
     };
 }
 
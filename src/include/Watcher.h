@@ -0,0 +1,59 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_WATCHER_H
+#define CPP_SERIALIZER_WATCHER_H
+
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+
+#include "FileWalker.h"
+
+namespace serializer {
+    /**
+     * Observa os headers do projeto com inotify (modo --watch).
+     *
+     * Cada diretório que o FileWalker percorreria recebe um watch; diretórios
+     * criados depois entram sozinhos. Eventos que chegam em rajada (salvar no
+     * editor, git checkout) são agrupados numa única lista de headers.
+     */
+    class Watcher {
+    public:
+        /**
+         * @param root Raiz do projeto
+         * @param options Mesmas podas da busca de headers
+         */
+        Watcher(std::filesystem::path root, WalkOptions options);
+        ~Watcher();
+
+        Watcher(const Watcher&) = delete;
+        Watcher& operator=(const Watcher&) = delete;
+
+        /**
+         * Inicia o inotify e registra os diretórios
+         * @return false se o sistema não suporta ou não foi possível observar
+         */
+        bool start();
+
+        /**
+         * Bloqueia até algum header ser alterado, criado ou removido
+         * @return Headers afetados (ordenados); todos os headers se a fila do kernel transbordou
+         */
+        [[nodiscard]] std::vector<std::filesystem::path> waitForChanges();
+
+        [[nodiscard]] size_t directoryCount() const { return directories_.size(); }
+
+    private:
+        // Observa dir (vazio = a raiz) e os subdiretórios não podados; headers recebe os que existirem
+        void watchTree(const std::filesystem::path& dir, std::vector<std::filesystem::path>* headers = nullptr);
+
+        std::filesystem::path root_;
+        WalkOptions options_;
+        int fd_ = -1;
+        std::unordered_map<int, std::filesystem::path> directories_;   // watch descriptor -> diretório
+    };
+}
+
+#endif //CPP_SERIALIZER_WATCHER_H
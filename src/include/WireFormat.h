@@ -0,0 +1,586 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_WIREFORMAT_H
+#define CPP_SERIALIZER_WIREFORMAT_H
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstring>
+#include <ranges>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "TypeTraits.h"
+
+/*
+ * Formato binário compacto, guiado pelo schema (sem nomes de campo):
+ *
+ *  - inteiros sem sinal .... varint LEB128
+ *  - inteiros com sinal .... zigzag + varint
+ *  - float/double .......... 4/8 bytes little-endian (long double vai como double)
+ *  - bool .................. 1 byte; campos bool de uma classe vão empacotados em bits
+ *  - string ................ varint(tamanho) + bytes
+ *  - optional/ponteiros .... 1 byte de presença + valor
+ *  - containers ............ varint(quantidade) + elementos (mapas: chave, valor)
+ *  - std::vector<bool> ..... varint(quantidade) + bits empacotados
+ *  - pair/tuple/std::array . elementos em ordem, sem quantidade
+ *  - variant ............... varint(índice) + valor
+ *  - classes SERIALIZABLE .. campos em ordem de declaração
+ *
+ * Blocos de primitivos (copiados com um memcpy em hosts little-endian):
+ *
+ *  - std::vector/std::array de primitivos (exceto bool e long double):
+ *    varint(quantidade, só no vector) + elementos com sizeof(T) bytes little-endian
+ *  - classes só com campos primitivos: cada campo com sizeof(T) bytes
+ *    little-endian, na ordem de declaração, sem bits empacotados
+ */
+namespace serializer {
+    class WireWriter;
+    class WireReader;
+
+    namespace detail {
+        template<typename T>
+        concept HasWriteBinary = requires(const T& obj, WireWriter& out) {
+            obj.writeBinary(out);
+        };
+
+        template<typename T>
+        concept HasReadBinary = requires(T& obj, WireReader& in) {
+            obj.readBinary(in);
+        };
+
+        template<typename T>
+        concept HasSerializedSize = requires(const T& obj) {
+            { obj.serializedSize() } -> std::convertible_to<size_t>;
+        };
+
+        // Funções livres achadas por ADL (geradas no modo --non-intrusive)
+        template<typename T>
+        concept HasFreeWriteBinary = requires(const T& obj, WireWriter& out) {
+            writeBinary(out, obj);
+        };
+
+        template<typename T>
+        concept HasFreeReadBinary = requires(T& obj, WireReader& in) {
+            readBinary(in, obj);
+        };
+
+        template<typename T>
+        concept HasFreeSerializedSize = requires(const T& obj) {
+            { serializedSize(obj) } -> std::convertible_to<size_t>;
+        };
+
+        // Primitivo com largura fixa no formato de bloco
+        template<typename T>
+        concept BlockElement = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                               !std::is_same_v<T, long double>;
+
+        // vector/array de primitivos: vai como bloco contíguo
+        template<typename T>
+        concept PrimitiveBlock = std::ranges::contiguous_range<T> &&
+                                 BlockElement<std::ranges::range_value_t<T>> &&
+                                 (IsStdArray<T>::value || requires(T& c, size_t n) { c.resize(n); });
+
+        inline constexpr bool LittleEndianHost = std::endian::native == std::endian::little;
+    }
+
+    /**
+     * A classe pode ir/voltar com um memcpy do objeto inteiro?
+     * Exige cópia trivial, host little-endian e nenhum padding
+     * (sizeof do objeto igual à soma dos campos serializados).
+     */
+    template<typename T>
+    [[nodiscard]] constexpr bool isWireRawCopyable(size_t fieldBytes) {
+        return std::is_trivially_copyable_v<T> && detail::LittleEndianHost &&
+               sizeof(T) == fieldBytes;
+    }
+
+    // Erro de leitura (mensagem truncada ou corrompida)
+    class WireFormatError : public std::runtime_error {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * Escritor do formato binário: anexa os bytes num buffer do chamador,
+     * que pode ser reutilizado entre mensagens.
+     */
+    class WireWriter {
+    public:
+        explicit WireWriter(std::string& out) : out_(out) {}
+
+        void byte(uint8_t b) {
+            out_.push_back(static_cast<char>(b));
+        }
+
+        void varint(uint64_t v) {
+            char buffer[10];
+            size_t n = 0;
+            while (v >= 0x80) {
+                buffer[n++] = static_cast<char>((v & 0x7F) | 0x80);
+                v >>= 7;
+            }
+            buffer[n++] = static_cast<char>(v);
+            out_.append(buffer, n);
+        }
+
+        void bytes(const void* data, size_t size) {
+            out_.append(static_cast<const char*>(data), size);
+        }
+
+        template<typename T>
+        void value(const T& v) {
+            using Type = std::remove_cvref_t<T>;
+
+            if constexpr (detail::HasFreeWriteBinary<Type>) {
+                writeBinary(*this, v);
+            } else if constexpr (detail::HasWriteBinary<Type>) {
+                v.writeBinary(*this);
+            } else if constexpr (std::is_same_v<Type, bool>) {
+                byte(v ? 1 : 0);
+            } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+                varint(zigzag(static_cast<int64_t>(v)));
+            } else if constexpr (std::is_integral_v<Type>) {
+                varint(static_cast<uint64_t>(v));
+            } else if constexpr (std::is_same_v<Type, float>) {
+                fixed(std::bit_cast<uint32_t>(v));
+            } else if constexpr (std::is_floating_point_v<Type>) {
+                fixed(std::bit_cast<uint64_t>(static_cast<double>(v)));
+            } else if constexpr (std::is_enum_v<Type>) {
+                value(static_cast<std::underlying_type_t<Type>>(v));
+            } else if constexpr (detail::StringLike<Type>) {
+                const std::string_view str(v);
+                varint(str.size());
+                bytes(str.data(), str.size());
+            } else if constexpr (detail::IsOptional<Type>::value ||
+                                 detail::IsSmartPointer<Type>::value ||
+                                 std::is_pointer_v<Type>) {
+                byte(v ? 1 : 0);
+                if (v) value(*v);
+            } else if constexpr (detail::IsWeakPointer<Type>::value) {
+                value(v.lock());
+            } else if constexpr (detail::IsPair<Type>::value) {
+                value(v.first);
+                value(v.second);
+            } else if constexpr (detail::PrimitiveBlock<Type>) {
+                if constexpr (!detail::IsStdArray<Type>::value) {
+                    varint(std::ranges::size(v));
+                }
+                block(std::ranges::data(v), std::ranges::size(v));
+            } else if constexpr (detail::IsTuple<Type>::value || detail::IsStdArray<Type>::value) {
+                std::apply([this](const auto&... items) { (value(items), ...); }, v);
+            } else if constexpr (detail::IsVariant<Type>::value) {
+                varint(v.index());
+                std::visit([this](const auto& item) { value(item); }, v);
+            } else if constexpr (detail::IsBoolVector<Type>::value) {
+                varint(v.size());
+                uint8_t bits = 0;
+                for (size_t i = 0; i < v.size(); ++i) {
+                    if (v[i]) bits |= static_cast<uint8_t>(1u << (i % 8));
+                    if (i % 8 == 7) {
+                        byte(bits);
+                        bits = 0;
+                    }
+                }
+                if (v.size() % 8 != 0) byte(bits);
+            } else if constexpr (detail::MapLike<Type>) {
+                varint(v.size());
+                for (const auto& [k, item] : v) {
+                    value(k);
+                    value(item);
+                }
+            } else if constexpr (detail::RangeLike<Type>) {
+                varint(static_cast<uint64_t>(std::distance(std::begin(v), std::end(v))));
+                for (const auto& item : v) {
+                    value(item);
+                }
+            } else {
+                static_assert(detail::AlwaysFalse<Type>, "Tipo não suportado pelo WireWriter");
+            }
+        }
+
+        // Primitivo com largura fixa (sizeof(T) bytes little-endian), usado por classes só com primitivos
+        template<typename T>
+        void fixedValue(T v) {
+            if constexpr (std::is_same_v<T, bool>) {
+                byte(v ? 1 : 0);
+            } else if constexpr (detail::LittleEndianHost) {
+                bytes(&v, sizeof(T));
+            } else {
+                fixed(std::bit_cast<UnsignedOf<T>>(v));
+            }
+        }
+
+        // Bloco de primitivos: um memcpy quando o host já é little-endian
+        template<typename T>
+        void block(const T* data, size_t count) {
+            if constexpr (detail::LittleEndianHost) {
+                bytes(data, count * sizeof(T));
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    fixed(std::bit_cast<UnsignedOf<T>>(data[i]));
+                }
+            }
+        }
+
+        [[nodiscard]] std::string& buffer() { return out_; }
+
+        /**
+         * Tamanho exato, em bytes, que value(v) vai escrever.
+         * Percorre o valor sem escrever nada (para reservar o buffer uma vez só).
+         */
+        template<typename T>
+        [[nodiscard]] static size_t sizeOf(const T& v) {
+            using Type = std::remove_cvref_t<T>;
+
+            if constexpr (detail::HasFreeSerializedSize<Type> && detail::HasFreeWriteBinary<Type>) {
+                return serializedSize(v);
+            } else if constexpr (detail::HasSerializedSize<Type> && detail::HasWriteBinary<Type>) {
+                return v.serializedSize();
+            } else if constexpr (std::is_same_v<Type, bool>) {
+                return 1;
+            } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+                return varintSize(zigzag(static_cast<int64_t>(v)));
+            } else if constexpr (std::is_integral_v<Type>) {
+                return varintSize(static_cast<uint64_t>(v));
+            } else if constexpr (std::is_same_v<Type, float>) {
+                return 4;
+            } else if constexpr (std::is_floating_point_v<Type>) {
+                return 8;
+            } else if constexpr (std::is_enum_v<Type>) {
+                return sizeOf(static_cast<std::underlying_type_t<Type>>(v));
+            } else if constexpr (detail::StringLike<Type>) {
+                const std::string_view str(v);
+                return varintSize(str.size()) + str.size();
+            } else if constexpr (detail::IsOptional<Type>::value ||
+                                 detail::IsSmartPointer<Type>::value ||
+                                 std::is_pointer_v<Type>) {
+                return v ? 1 + sizeOf(*v) : 1;
+            } else if constexpr (detail::IsWeakPointer<Type>::value) {
+                return sizeOf(v.lock());
+            } else if constexpr (detail::IsPair<Type>::value) {
+                return sizeOf(v.first) + sizeOf(v.second);
+            } else if constexpr (detail::PrimitiveBlock<Type>) {
+                const size_t count = std::ranges::size(v);
+                const size_t prefix = detail::IsStdArray<Type>::value ? 0 : varintSize(count);
+                return prefix + count * sizeof(std::ranges::range_value_t<Type>);
+            } else if constexpr (detail::IsTuple<Type>::value || detail::IsStdArray<Type>::value) {
+                return std::apply([](const auto&... items) { return (size_t{0} + ... + sizeOf(items)); }, v);
+            } else if constexpr (detail::IsVariant<Type>::value) {
+                return varintSize(v.index()) +
+                       std::visit([](const auto& item) { return sizeOf(item); }, v);
+            } else if constexpr (detail::IsBoolVector<Type>::value) {
+                return varintSize(v.size()) + (v.size() + 7) / 8;
+            } else if constexpr (detail::MapLike<Type>) {
+                size_t size = varintSize(v.size());
+                for (const auto& [k, item] : v) {
+                    size += sizeOf(k) + sizeOf(item);
+                }
+                return size;
+            } else if constexpr (detail::RangeLike<Type>) {
+                size_t size = varintSize(static_cast<uint64_t>(std::distance(std::begin(v), std::end(v))));
+                for (const auto& item : v) {
+                    size += sizeOf(item);
+                }
+                return size;
+            } else {
+                static_assert(detail::AlwaysFalse<Type>, "Tipo não suportado pelo WireWriter");
+            }
+        }
+
+        [[nodiscard]] static size_t varintSize(uint64_t v) {
+            // 1 byte a cada 7 bits significativos (mínimo 1)
+            return static_cast<size_t>(std::bit_width(v | 1) + 6) / 7;
+        }
+
+    private:
+        template<typename T>
+        using UnsignedOf = std::conditional_t<sizeof(T) == 1, uint8_t,
+                           std::conditional_t<sizeof(T) == 2, uint16_t,
+                           std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+        static uint64_t zigzag(int64_t v) {
+            return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+        }
+
+        template<typename U>
+        void fixed(U bits) {
+            char buffer[sizeof(U)];
+            for (size_t i = 0; i < sizeof(U); ++i) {
+                buffer[i] = static_cast<char>(bits >> (8 * i));
+            }
+            out_.append(buffer, sizeof(U));
+        }
+
+        std::string& out_;
+    };
+
+    /**
+     * Leitor do formato binário. Valida limites a cada leitura e lança
+     * WireFormatError em mensagens truncadas.
+     *
+     * Com um memory_resource, objetos gerados com --pmr criados durante a
+     * leitura passam a alocar nele (mesma regra do JsonReader).
+     */
+    class WireReader {
+    public:
+        explicit WireReader(std::string_view input, std::pmr::memory_resource* resource = nullptr)
+            : input_(input), resource_(resource) {}
+
+        uint8_t byte() {
+            need(1);
+            return static_cast<uint8_t>(input_[pos_++]);
+        }
+
+        uint64_t varint() {
+            uint64_t result = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                const uint8_t b = byte();
+                if (shift == 63 && b > 1) {
+                    break;  // o décimo byte só carrega o bit 63
+                }
+                result |= static_cast<uint64_t>(b & 0x7F) << shift;
+                if ((b & 0x80) == 0) {
+                    return result;
+                }
+            }
+            throw WireFormatError("varint inválido");
+        }
+
+        std::string_view bytes(size_t size) {
+            need(size);
+            std::string_view result = input_.substr(pos_, size);
+            pos_ += size;
+            return result;
+        }
+
+        template<typename T>
+        void read(T& v) {
+            using Type = std::remove_cvref_t<T>;
+
+            if constexpr (detail::HasFreeReadBinary<Type>) {
+                readBinary(*this, v);
+            } else if constexpr (detail::HasReadBinary<Type>) {
+                v.readBinary(*this);
+            } else if constexpr (std::is_same_v<Type, bool>) {
+                v = byte() != 0;
+            } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+                const uint64_t raw = varint();
+                const int64_t value = static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+                if (value < std::numeric_limits<Type>::min() || value > std::numeric_limits<Type>::max()) {
+                    throw WireFormatError("inteiro fora do intervalo");
+                }
+                v = static_cast<Type>(value);
+            } else if constexpr (std::is_integral_v<Type>) {
+                const uint64_t value = varint();
+                if (value > std::numeric_limits<Type>::max()) {
+                    throw WireFormatError("inteiro fora do intervalo");
+                }
+                v = static_cast<Type>(value);
+            } else if constexpr (std::is_same_v<Type, float>) {
+                v = std::bit_cast<float>(fixed<uint32_t>());
+            } else if constexpr (std::is_floating_point_v<Type>) {
+                v = static_cast<Type>(std::bit_cast<double>(fixed<uint64_t>()));
+            } else if constexpr (std::is_enum_v<Type>) {
+                std::underlying_type_t<Type> raw{};
+                read(raw);
+                v = static_cast<Type>(raw);
+            } else if constexpr (detail::IsStdString<Type>::value) {
+                const std::string_view str = bytes(varint());
+                v.assign(str.data(), str.size());
+            } else if constexpr (std::is_same_v<Type, std::string_view>) {
+                static_assert(detail::AlwaysFalse<Type>,
+                              "std::string_view não é dona do texto e não pode ser lida: use std::string");
+            } else if constexpr (detail::IsOptional<Type>::value) {
+                if (byte()) {
+                    if (!v) adopt(v.emplace());
+                    read(*v);
+                } else {
+                    v.reset();
+                }
+            } else if constexpr (detail::IsSmartPointer<Type>::value) {
+                if (byte()) {
+                    if (!v) {
+                        v.reset(new typename Type::element_type());
+                        adopt(*v);
+                    }
+                    read(*v);
+                } else {
+                    v.reset();
+                }
+            } else if constexpr (detail::IsPair<Type>::value) {
+                read(v.first);
+                read(v.second);
+            } else if constexpr (detail::PrimitiveBlock<Type>) {
+                using Element = std::ranges::range_value_t<Type>;
+                if constexpr (detail::IsStdArray<Type>::value) {
+                    readBlock(v.data(), v.size());
+                } else {
+                    const uint64_t count = varint();
+                    if (count > remaining() / sizeof(Element)) {
+                        throw WireFormatError("mensagem binária truncada");
+                    }
+                    v.resize(count);
+                    readBlock(v.data(), count);
+                }
+            } else if constexpr (detail::IsTuple<Type>::value || detail::IsStdArray<Type>::value) {
+                std::apply([this](auto&... items) { (read(items), ...); }, v);
+            } else if constexpr (detail::IsVariant<Type>::value) {
+                const uint64_t index = varint();
+                if (index >= std::variant_size_v<Type>) {
+                    throw WireFormatError("índice de variant inválido");
+                }
+                readVariant(v, index, std::make_index_sequence<std::variant_size_v<Type>>{});
+            } else if constexpr (detail::IsBoolVector<Type>::value) {
+                const uint64_t count = varint();
+                // Compara antes de arredondar: (count + 7) / 8 daria a volta perto de UINT64_MAX
+                if (count / 8 > remaining() || (count % 8 != 0 && count / 8 == remaining())) {
+                    throw WireFormatError("mensagem binária truncada");
+                }
+                const std::string_view packed = bytes((count + 7) / 8);
+                v.resize(count);
+                for (size_t i = 0; i < count; ++i) {
+                    v[i] = (static_cast<uint8_t>(packed[i / 8]) >> (i % 8)) & 1u;
+                }
+            } else if constexpr (detail::MapLike<Type>) {
+                const uint64_t count = varint();
+                v.clear();
+                for (uint64_t i = 0; i < count; ++i) {
+                    auto key = detail::makeElementFor<typename Type::key_type>(v);
+                    auto item = detail::makeElementFor<typename Type::mapped_type>(v);
+                    adopt(key);
+                    adopt(item);
+                    read(key);
+                    read(item);
+                    v.emplace_hint(v.end(), std::move(key), std::move(item));
+                }
+            } else if constexpr (detail::SetLike<Type>) {
+                const uint64_t count = varint();
+                v.clear();
+                for (uint64_t i = 0; i < count; ++i) {
+                    auto item = detail::makeElementFor<typename Type::value_type>(v);
+                    adopt(item);
+                    read(item);
+                    v.emplace_hint(v.end(), std::move(item));
+                }
+            } else if constexpr (detail::SequenceLike<Type>) {
+                const uint64_t count = varint();
+                uint64_t reused = 0;
+                if constexpr (detail::ReusableSequence<Type>) {
+                    // Sobrescreve os elementos que já existem (mantendo a memória deles) e só acrescenta o que faltar
+                    reused = std::min<uint64_t>(count, v.size());
+                    for (uint64_t i = 0; i < reused; ++i) {
+                        read(v[i]);
+                    }
+                    v.erase(v.begin() + reused, v.end());
+                } else {
+                    v.clear();
+                }
+                if constexpr (detail::HasReserve<Type>) {
+                    // Cada elemento ocupa ao menos 1 byte: não confia em contagens absurdas
+                    v.reserve(reused + std::min<uint64_t>(count - reused, remaining()));
+                }
+                for (uint64_t i = reused; i < count; ++i) {
+                    auto& item = v.emplace_back();
+                    adopt(item);
+                    read(item);
+                }
+            } else {
+                static_assert(detail::AlwaysFalse<Type>, "Tipo não suportado pelo WireReader");
+            }
+        }
+
+        // Contraparte de WireWriter::fixedValue
+        template<typename T>
+        void readFixed(T& v) {
+            if constexpr (std::is_same_v<T, bool>) {
+                v = byte() != 0;
+            } else if constexpr (detail::LittleEndianHost) {
+                std::memcpy(&v, bytes(sizeof(T)).data(), sizeof(T));
+            } else {
+                v = std::bit_cast<T>(fixed<UnsignedOf<T>>());
+            }
+        }
+
+        template<typename T>
+        void readBlock(T* data, size_t count) {
+            if constexpr (detail::LittleEndianHost) {
+                if (count > 0) {
+                    std::memcpy(data, bytes(count * sizeof(T)).data(), count * sizeof(T));
+                }
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    data[i] = std::bit_cast<T>(fixed<UnsignedOf<T>>());
+                }
+            }
+        }
+
+        // Copia os próximos `size` bytes crus (usado no caminho memcpy de classes só com primitivos)
+        void copyTo(void* target, size_t size) {
+            std::memcpy(target, bytes(size).data(), size);
+        }
+
+        // Garante que a mensagem foi consumida por inteiro
+        void finish() const {
+            if (pos_ != input_.size()) {
+                throw WireFormatError("bytes extras após o fim da mensagem");
+            }
+        }
+
+        [[nodiscard]] size_t position() const { return pos_; }
+        [[nodiscard]] size_t remaining() const { return input_.size() - pos_; }
+        [[nodiscard]] std::pmr::memory_resource* resource() const { return resource_; }
+
+    private:
+        void need(size_t size) const {
+            if (size > input_.size() - pos_) {
+                throw WireFormatError("mensagem binária truncada");
+            }
+        }
+
+        template<typename T>
+        using UnsignedOf = std::conditional_t<sizeof(T) == 1, uint8_t,
+                           std::conditional_t<sizeof(T) == 2, uint16_t,
+                           std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+        template<typename U>
+        U fixed() {
+            const std::string_view raw = bytes(sizeof(U));
+            U bits = 0;
+            for (size_t i = 0; i < sizeof(U); ++i) {
+                bits |= static_cast<U>(static_cast<uint8_t>(raw[i])) << (8 * i);
+            }
+            return bits;
+        }
+
+        template<typename V, size_t... I>
+        void readVariant(V& v, uint64_t index, std::index_sequence<I...>) {
+            ((index == I ? (read(v.template emplace<I>()), true) : false) || ...);
+        }
+
+        template<typename T>
+        void adopt(T& item) {
+            if constexpr (detail::HasUseMemoryResource<T>) {
+                if (resource_) item.useMemoryResource(resource_);
+            }
+        }
+
+        std::string_view input_;
+        std::pmr::memory_resource* resource_ = nullptr;
+        size_t pos_ = 0;
+    };
+}
+
+#endif //CPP_SERIALIZER_WIREFORMAT_H
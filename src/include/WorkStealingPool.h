@@ -0,0 +1,38 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_WORKSTEALINGPOOL_H
+#define CPP_SERIALIZER_WORKSTEALINGPOOL_H
+
+#include <cstddef>
+#include <functional>
+
+namespace serializer {
+    /**
+     * Executa tarefas indexadas em paralelo com roubo de trabalho.
+     *
+     * Cada thread recebe um bloco contíguo de índices e consome do início da
+     * própria fila; quando ela esvazia, rouba do fim da fila de outra thread.
+     * Assim headers grandes (ou lentos de ler) não deixam núcleos parados.
+     */
+    class WorkStealingPool {
+    public:
+        explicit WorkStealingPool(unsigned jobs) : jobs_(jobs == 0 ? 1 : jobs) {}
+
+        /**
+         * Chama task(i) para cada i em [0, count) e espera todas terminarem
+         * @param count Quantidade de tarefas
+         * @param task Tarefa; deve escrever só no slot do seu índice
+         * @throws A primeira exceção lançada por alguma tarefa (as demais param)
+         */
+        void parallelFor(size_t count, const std::function<void(size_t)>& task) const;
+
+        [[nodiscard]] unsigned jobs() const { return jobs_; }
+
+    private:
+        unsigned jobs_;
+    };
+}
+
+#endif //CPP_SERIALIZER_WORKSTEALINGPOOL_H
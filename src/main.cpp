@@ -1,22 +1,32 @@
+#include <algorithm>
 #include <iostream>
 #include <filesystem>
+#include <fstream>
 #include <functional>
+#include <set>
 
+#include "include/BuildManifest.h"
+#include "include/ClassTable.h"
 #include "include/CodeGenerator.h"
 #include "include/FileWalker.h"
+#include "include/Options.h"
+#include "include/ParseCache.h"
 #include "include/Parser.h"
+#include "include/Profiler.h"
+#include "include/SourceFile.h"
 #include "include/TypeChecker.h"
+#include "include/Watcher.h"
+#include "include/WorkStealingPool.h"
 
 namespace fs = std::filesystem;
 
 int main(int argc, char* argv[]) {
-    if (argc != 2) {
-        std::cerr << "Uso: " << argv[0] << " <caminho-do-projeto>\n";
-        std::cerr << "Exemplo: " << argv[0] << " ./meu_projeto\n";
+    auto options = serializer::parseOptions(argc, argv);
+    if (!options) {
         return 1;
     }
 
-    fs::path projectPath = argv[1];
+    fs::path projectPath = options->projectPath;
 
     // Verifica se o caminho existe
     if (!fs::exists(projectPath)) {
@@ -32,165 +42,564 @@ int main(int argc, char* argv[]) {
     serializer::Parser parser;
     serializer::TypeChecker typeChecker;
     serializer::CodeGenerator generator;
+    serializer::WorkStealingPool pool(options->jobs);
+    serializer::Profiler profiler(options->profile);
+    using Phase = serializer::Profiler::Phase;
+    using Counter = serializer::Profiler::Counter;
 
     // Configura generator
     generator.setGenerateJson(true);
     generator.setGenerateGeneric(true);
+    generator.setGenerateBinary(true);
+    generator.setGeneratePmr(options->generatePmr);
+    generator.setNonIntrusive(options->nonIntrusive);
+    generator.setOutOfLine(options->outOfLine);
+    if (options->nonIntrusive && options->generatePmr) {
+        std::cout << "⚠️  --pmr é ignorado com --non-intrusive (useMemoryResource precisa ser membro)\n\n";
+    }
     generator.setIndentSize(4);
 
     // Encontra headers
     std::cout << "🔍 Procurando arquivos header...\n";
-    auto headers = walker.findHeaderFiles(projectPath);
+    serializer::WalkStats walkStats;
+    auto headers = [&] {
+        auto timer = profiler.time(Phase::Walk);
+        return walker.findHeaderFiles(projectPath, options->walk, &walkStats);
+    }();
+    profiler.set(Counter::EntriesVisited, walkStats.entriesVisited);
+    profiler.set(Counter::DirectoriesSkipped, walkStats.directoriesSkipped);
+
+    // Relatório do --profile: fecha os contadores dos componentes e zera tudo para a próxima rodada
+    const auto reportProfile = [&] {
+        if (!profiler.enabled()) {
+            return;
+        }
 
-    if (headers.empty()) {
-        std::cout << "⚠️  Nenhum arquivo header encontrado\n";
-        return 0;
-    }
+        const auto typeStats = typeChecker.stats();
+        const auto& generatorStats = generator.stats();
+        profiler.set(Counter::AnalyzeTypeCalls, typeStats.analyzeTypeCalls);
+        profiler.set(Counter::AnalyzeTypeCacheHits, typeStats.cacheHits);
+        profiler.add(Counter::BytesRead, generatorStats.bytesRead);
+        profiler.set(Counter::FilesWritten, generatorStats.filesWritten);
+        profiler.set(Counter::FilesUnchanged, generatorStats.filesUnchanged);
+        profiler.set(Counter::BytesWritten, generatorStats.bytesWritten);
+
+        if (options->profileOutput) {
+            std::ofstream file(*options->profileOutput, std::ios::trunc);
+            profiler.report(file);
+            if (!file) {
+                std::cerr << "⚠️  Não foi possível gravar o perfil em " << *options->profileOutput << "\n";
+            }
+        } else {
+            profiler.report(std::cout);
+        }
 
-    std::cout << "📄 Encontrados " << headers.size() << " headers\n\n";
+        profiler.reset();
+        typeChecker.resetStats();
+        generator.resetStats();
+    };
 
     // Diretório para arquivos gerados
     fs::path generatedDir = projectPath / "generated_serializers";
 
-    // Lista para armazenar todas as classes encontradas
-    std::vector<serializer::ClassInfo> allClasses;
-    std::unordered_map<std::string, serializer::ClassInfo> classMap;
-    std::unordered_map<std::string, fs::path> classToFileMap;
+    // Tabela com todas as classes encontradas; as passadas seguintes usam os IDs
+    serializer::ClassTable classes;
 
-    // Primeira passagem: parse todas as classes e registra no TypeChecker
-    std::cout << "📊 Analisando classes...\n";
-    for (const auto& header : headers) {
-        if (parser.containsSerializableMacro(header)) {
-            std::cout << "  📄 " << header.filename() << "\n";
+    // --depfile e --manifest: gravados depois de tudo (inclusive dos headers modificados),
+    // assim o manifesto é o arquivo mais novo da regra e o build não roda o gerador de novo
+    const auto writeBuildOutputs = [&] {
+        if (!options->depfile && !options->manifest) {
+            return;
+        }
 
-            auto classInfo = parser.parseClass(header);
-            if (!classInfo || classInfo.value().fields.empty()) {
-                continue;
+        serializer::BuildManifest manifest;
+        for (const auto id : classes.ids()) {
+            const auto& classInfo = classes[id];
+            serializer::BuildManifest::Entry entry;
+            entry.className = classInfo.name;
+            entry.header = classes.header(id);
+            for (const auto& dep : classInfo.dependencies) {
+                const auto depId = classes.find(dep);
+                if (depId != serializer::ClassTable::NONE && classes.header(depId) != entry.header) {
+                    entry.dependencies.push_back(classes.header(depId));
+                }
             }
+            entry.outputs = generator.outputFiles(classInfo, generatedDir);
+            manifest.add(std::move(entry));
+        }
 
-            // Registra no TypeChecker
-            typeChecker.registerSerializableClass(*classInfo);
+        bool written = true;
+        if (options->depfile) {
+            // Alvo da regra: o manifesto (que o build declara como saída) ou os próprios arquivos gerados
+            const auto targets = options->manifest ? std::vector{*options->manifest} : manifest.outputs();
+            written &= serializer::BuildManifest::write(*options->depfile,
+                                                        targets.empty() ? "" : manifest.toDepfile(targets));
+        }
+        if (options->manifest) {
+            written &= serializer::BuildManifest::write(*options->manifest, manifest.toJson());
+        }
+        if (!written) {
+            std::cerr << "⚠️  Não foi possível gravar o depfile/manifesto\n";
+        }
+    };
+
+    if (headers.empty()) {
+        std::cout << "⚠️  Nenhum arquivo header encontrado\n";
+        if (!options->watch) {
+            writeBuildOutputs();
+            reportProfile();
+            return 0;
+        }
+    }
 
-            // Armazena
-            allClasses.push_back(*classInfo);
-            classMap[classInfo->name] = *classInfo;
-            classToFileMap[classInfo->name] = header;
+    std::cout << "📄 Encontrados " << headers.size() << " headers\n\n";
+
+    // Primeira passagem (paralela): detecta a macro e parseia cada header.
+    // Cada tarefa só escreve no slot do seu header; nada é compartilhado.
+    std::cout << "📊 Analisando classes";
+    if (pool.jobs() > 1) std::cout << " (" << pool.jobs() << " threads)";
+    std::cout << "...\n";
+
+    // Cache do parse: headers que não mudaram desde a última execução nem são lidos
+    serializer::ParseCache cache(generatedDir / serializer::ParseCache::FILE_NAME);
+    if (options->useCache) {
+        cache.load();
+    }
+
+    // Detecta a macro e parseia um conteúdo já lido (hash calculado pelo chamador)
+    const auto parseContent = [&](const fs::path& header, std::string_view content,
+                                  serializer::ParseCache::Entry& entry) {
+        {
+            auto timer = profiler.time(Phase::Scan);
+            entry.hasMacro = parser.containsSerializableMacro(content);
+        }
+        entry.classInfo.reset();
+        if (entry.hasMacro) {
+            auto timer = profiler.time(Phase::Parse);
+            entry.classInfo = parser.parseClass(header, content);
+            if (entry.classInfo) profiler.add(Counter::ClassesParsed);
+        }
+    };
 
-            std::cout << "    ✨ " << classInfo->name
-                      << " (" << classInfo->getSerializableFieldCount()
-                      << " campos serializáveis)\n";
+    std::vector<serializer::ParseCache::Entry> entries(headers.size());
+    std::vector<char> fromCache(headers.size(), 0);
+    auto headersTimer = profiler.time(Phase::Headers);
+    pool.parallelFor(headers.size(), [&](size_t i) {
+        auto& entry = entries[i];
+        auto readTimer = profiler.time(Phase::Read);
+        if (!serializer::ParseCache::stamp(headers[i], entry)) {
+            return;
         }
+
+        const auto reuse = [&](const serializer::ParseCache::Entry& cached) {
+            entry.hash = cached.hash;
+            entry.hasMacro = cached.hasMacro;
+            entry.classInfo = cached.classInfo;
+            fromCache[i] = 1;
+        };
+
+        // O cache só é lido aqui (a escrita é depois, em série)
+        if (const auto* cached = cache.find(headers[i], entry)) {
+            reuse(*cached);
+            return;
+        }
+
+        // Uma leitura por arquivo: hash, detecção e parse usam o mesmo buffer
+        auto source = serializer::SourceFile::open(headers[i]);
+        if (!source) {
+            return;
+        }
+        profiler.add(Counter::BytesRead, source->content().size());
+        entry.hash = serializer::ParseCache::hashContent(source->content());
+        if (const auto* cached = cache.find(headers[i], entry)) {
+            reuse(*cached);
+            return;
+        }
+        readTimer.stop();
+
+        parseContent(headers[i], source->content(), entry);
+    });
+    headersTimer.stop();
+
+    const auto cachedCount = std::ranges::count(fromCache, 1);
+    profiler.add(Counter::HeadersFound, headers.size());
+    profiler.add(Counter::HeadersFromCache, cachedCount);
+    if (cachedCount > 0) {
+        std::cout << "💾 " << cachedCount << " de " << headers.size() << " headers sem mudanças (cache)\n";
     }
 
-    if (allClasses.empty()) {
-        std::cout << "\n⚠️  Nenhuma classe com SERIALIZABLE encontrada\n";
-        return 0;
+    // Registra a classe de um header (se houver) no TypeChecker e na tabela
+    const auto registerClass = [&](const fs::path& header, const serializer::ParseCache::Entry& entry) {
+        const auto& classInfo = entry.classInfo;
+        if (!entry.hasMacro || !classInfo || classInfo->fields.empty()) {
+            return false;
+        }
+
+        // Registra no TypeChecker
+        typeChecker.registerSerializableClass(*classInfo);
+
+        // Armazena (a entrada do cache fica com a sua cópia, a tabela com a dela)
+        classes.add(*classInfo, header);
+
+        std::cout << "    ✨ " << classInfo->name
+                  << " (" << classInfo->getSerializableFieldCount()
+                  << " campos serializáveis)\n";
+        return true;
+    };
+
+    // Registro no TypeChecker na ordem dos headers: saída determinística
+    auto registerTimer = profiler.time(Phase::Register);
+    for (size_t i = 0; i < headers.size(); ++i) {
+        if (!entries[i].hasMacro) {
+            continue;
+        }
+
+        std::cout << "  📄 " << headers[i].filename() << "\n";
+        registerClass(headers[i], entries[i]);
     }
+    registerTimer.stop();
+
+    // Grava o cache no fim da execução, depois de os headers terem sido modificados
+    const auto saveCache = [&] {
+        auto timer = profiler.time(Phase::Cache);
+        for (size_t i = 0; i < headers.size(); ++i) {
+            auto& entry = entries[i];
+            if (entry.size == 0 && entry.modified == 0) {
+                continue;   // Não foi possível ler (ou foi removido)
+            }
 
-    std::cout << "\n🔗 Analisando dependências...\n";
+            // modifyOriginalClass reescreve o header: parseia de novo para guardar o
+            // conteúdo final, senão a próxima execução (ou o --watch) não o reaproveitaria
+            serializer::ParseCache::Entry current;
+            if (entry.hasMacro && serializer::ParseCache::stamp(headers[i], current) &&
+                (current.size != entry.size || current.modified != entry.modified)) {
+                if (auto source = serializer::SourceFile::open(headers[i])) {
+                    current.hash = serializer::ParseCache::hashContent(source->content());
+                    parseContent(headers[i], source->content(), current);
+                    entry = std::move(current);
+                }
+            }
+            if (options->useCache) {
+                cache.store(headers[i], entry);
+            }
+        }
 
-    // Segunda passagem: analisa dependências com TypeChecker atualizado
-    for (auto& classInfo : allClasses) {
-        // Re-parse com análise de dependências
-        auto updatedInfo = parser.parseClassWithDependencies(
-            classToFileMap[classInfo.name],
-            typeChecker
-        );
+        if (!options->useCache) {
+            return;
+        }
+        cache.retainOnly(headers);
+        if (!cache.save()) {
+            std::cerr << "⚠️  Não foi possível gravar o cache em " << generatedDir << "\n";
+        }
+    };
 
-        if (updatedInfo) {
-            classInfo = *updatedInfo;
+    // Segunda passagem (paralela): dependências a partir das classes já parseadas,
+    // sem reler os arquivos. O TypeChecker já está completo e só é lido.
+    const auto analyzeAll = [&](bool verbose) {
+        auto timer = profiler.time(Phase::Dependencies);
+        const auto& ids = classes.ids();
+        pool.parallelFor(ids.size(), [&](size_t i) {
+            parser.analyzeDependencies(classes[ids[i]], typeChecker);
+        });
+
+        // Ciclos e profundidade de aninhamento: uma passada sobre o grafo inteiro
+        typeChecker.analyzeClassGraph(classes);
+
+        // Dependentes: o inverso das dependências (usado pelo --watch para propagar mudanças)
+        std::unordered_map<serializer::ClassId, std::set<std::string>> dependents;
+        for (const auto id : ids) {
+            for (const auto& dep : classes[id].dependencies) {
+                if (const auto depId = classes.find(dep); depId != serializer::ClassTable::NONE) {
+                    dependents[depId].insert(classes[id].name);
+                }
+            }
+        }
+
+        for (const auto id : ids) {
+            auto& classInfo = classes[id];
+            classInfo.dependents.clear();
+            for (const auto& dependent : dependents[id]) {
+                classInfo.addDependent(dependent);
+            }
 
-            if (!classInfo.dependencies.empty()) {
+            if (verbose && !classInfo.dependencies.empty()) {
                 std::cout << "  📦 " << classInfo.name << " depende de: ";
                 for (const auto& dep : classInfo.dependencies) {
                     std::cout << dep << " ";
                 }
                 std::cout << "\n";
             }
+            if (verbose && classInfo.hasCircularDependency) {
+                std::cout << "  🔁 " << classInfo.name << " faz parte de uma dependência circular\n";
+            }
         }
-    }
+    };
 
     // Ordenação topológica simples (para evitar dependências circulares)
-    std::cout << "\n⚙️  Ordenando por dependências...\n";
-    std::vector<serializer::ClassInfo> orderedClasses;
-    std::unordered_set<std::string> generated;
+    // only: restringe às classes do conjunto (nullptr = todas)
+    const auto orderClasses = [&](const std::unordered_set<std::string>* only, bool verbose) {
+        auto timer = profiler.time(Phase::Sort);
+        std::vector<serializer::ClassId> orderedClasses;
+        std::unordered_set<serializer::ClassId> generated;
+
+        // Função auxiliar para ordenação
+        std::function<void(serializer::ClassId)> processClass;
+        processClass = [&](serializer::ClassId id) {
+            const auto& classInfo = classes[id];
+            if (generated.count(id)) return;
+            if (only && !only->count(classInfo.name)) return;
+
+            // Marca antes de descer: num ciclo a volta para esta classe para aqui
+            generated.insert(id);
+
+            // Primeiro processa dependências
+            for (const auto& dep : classInfo.dependencies) {
+                if (const auto depId = classes.find(dep); depId != serializer::ClassTable::NONE) {
+                    processClass(depId);
+                }
+            }
 
-    // Função auxiliar para ordenação
-    std::function<void(const serializer::ClassInfo&)> processClass;
-    processClass = [&](const serializer::ClassInfo& classInfo) {
-        if (generated.count(classInfo.name)) return;
+            // Depois processa esta classe
+            orderedClasses.push_back(id);
 
-        // Primeiro processa dependências
-        for (const auto& dep : classInfo.dependencies) {
-            if (classMap.count(dep) && !generated.count(dep)) {
-                processClass(classMap[dep]);
+            if (verbose) {
+                std::cout << "  " << (orderedClasses.size()) << ". "
+                          << classInfo.name << "\n";
             }
+        };
+
+        for (const auto id : classes.ids()) {
+            processClass(id);
         }
+        return orderedClasses;
+    };
+
+    int processed = 0;
+    int errors = 0;
+
+    // Gera serialização
+    const auto generateClasses = [&](const std::vector<serializer::ClassId>& orderedClasses) {
+        auto timer = profiler.time(Phase::Generate);
+        for (const auto id : orderedClasses) {
+            const auto& classInfo = classes[id];
+            std::cout << "\n📄 Processando: " << classInfo.name << "\n";
+
+            // Gera arquivo de implementação
+            auto implFile = generator.generateImplFile(
+                classInfo,
+                generatedDir,
+                typeChecker
+            );
+
+            if (!implFile) {
+                std::cout << "   ❌ Falha ao gerar implementação\n";
+                errors++;
+                continue;
+            }
 
-        // Depois processa esta classe
-        orderedClasses.push_back(classInfo);
-        generated.insert(classInfo.name);
+            // Modo não intrusivo: tudo está no arquivo gerado, o header fica como está
+            if (generator.nonIntrusive()) {
+                processed++;
+                std::cout << "   ✅ Sucesso!\n";
+                continue;
+            }
 
-        std::cout << "  " << (orderedClasses.size()) << ". "
-                  << classInfo.name << "\n";
+            // Modifica classe original
+            if (generator.modifyOriginalClass(classes.header(id), classInfo)) {
+                processed++;
+                std::cout << "   ✅ Sucesso!\n";
+            } else {
+                errors++;
+                std::cout << "   ❌ Falha ao modificar classe\n";
+            }
+        }
     };
 
-    for (const auto& classInfo : allClasses) {
-        processClass(classInfo);
+    if (classes.empty()) {
+        std::cout << "\n⚠️  Nenhuma classe com SERIALIZABLE encontrada\n";
+        saveCache();
+        writeBuildOutputs();
+        if (!options->watch) {
+            reportProfile();
+            return 0;
+        }
+    } else {
+        std::cout << "\n🔗 Analisando dependências...\n";
+        analyzeAll(true);
+
+        std::cout << "\n⚙️  Ordenando por dependências...\n";
+        const auto orderedClasses = orderClasses(nullptr, true);
+
+        std::cout << "\n🚀 Gerando serialização...\n";
+        generateClasses(orderedClasses);
+
+        saveCache();
+        if (errors == 0) {
+            writeBuildOutputs();
+        }
+
+        // Resumo
+        std::cout << "\n" << std::string(40, '=') << "\n";
+        std::cout << "📊 Resultado Final:\n";
+        std::cout << "   ✅ Processadas: " << processed << "\n";
+        std::cout << "   ❌ Erros: " << errors << "\n";
+        std::cout << "   📁 Total de classes: " << classes.size() << "\n";
+
+        if (processed > 0) {
+            std::cout << "\n🎉 Serialização gerada com sucesso!\n";
+            std::cout << "📁 Arquivos gerados em: " << generatedDir << "\n";
+            std::cout << "\n💡 Como usar nas suas classes:\n";
+            if (options->nonIntrusive) {
+                std::cout << "   #include \"SuaClasse_serialization_impl.h\"\n";
+                std::cout << "   \n";
+                std::cout << "   SuaClasse obj;\n";
+                std::cout << "   nlohmann::json json = obj;             // Para JSON (to_json)\n";
+                std::cout << "   auto novo = json.get<SuaClasse>();     // De JSON (from_json)\n";
+                std::cout << "   writeJson(buffer, obj);                // JSON direto no buffer\n";
+                std::cout << "   serializeBinary(buffer, obj);          // Binário compacto\n";
+            } else {
+                std::cout << "   #include \"sua_classe.h\"\n";
+                std::cout << "   \n";
+                std::cout << "   SuaClasse obj;\n";
+                std::cout << "   nlohmann::json json = obj.serialize();  // Para JSON\n";
+                std::cout << "   obj.deserialize(json);                 // De JSON\n";
+                std::cout << "   auto novo = SuaClasse::fromJson(json); // Factory method\n";
+            }
+        }
     }
 
-    // Gera serialização
-    std::cout << "\n🚀 Gerando serialização...\n";
-    int processed = 0;
-    int errors = 0;
+    reportProfile();
+    if (!options->watch) {
+        return errors > 0 ? 1 : 0;
+    }
 
-    for (const auto& classInfo : orderedClasses) {
-        std::cout << "\n📄 Processando: " << classInfo.name << "\n";
+    // Modo --watch: TypeChecker, classes e cache ficam em memória; a cada mudança
+    // só o header alterado é relido e só a classe dele e seus dependentes são regerados
+    serializer::WalkOptions watchOptions = options->walk;
+    watchOptions.ignorePatterns.push_back("/" + generatedDir.filename().string() + "/");
+    serializer::Watcher watcher(projectPath, watchOptions);
+    if (!watcher.start()) {
+        return 1;
+    }
+    std::cout << "\n👀 Observando " << watcher.directoryCount() << " diretórios (Ctrl+C para sair)" << std::endl;
+
+    std::unordered_map<std::string, size_t> headerIndex;
+    for (size_t i = 0; i < headers.size(); ++i) {
+        headerIndex[headers[i].string()] = i;
+    }
+
+    while (true) {
+        auto changed = watcher.waitForChanges();
+
+        // Headers que saíram junto com um diretório movido não geram evento próprio
+        for (const auto id : classes.ids()) {
+            std::error_code ec;
+            if (!fs::exists(classes.header(id), ec)) changed.push_back(classes.header(id));
+        }
+        std::ranges::sort(changed);
+        changed.erase(std::ranges::unique(changed).begin(), changed.end());
+
+        // Classes que precisam ser regeradas (alteradas, novas ou que perderam uma dependência)
+        std::unordered_set<std::string> touched;
+
+        for (const auto& header : changed) {
+            auto [it, added] = headerIndex.try_emplace(header.string(), headers.size());
+            if (added) {
+                headers.push_back(header);
+                entries.emplace_back();
+            }
+            const size_t i = it->second;
+
+            serializer::ParseCache::Entry entry;
+            const bool exists = serializer::ParseCache::stamp(header, entry);
+            if (exists) {
+                auto source = serializer::SourceFile::open(header);
+                if (!source) continue;
+                profiler.add(Counter::BytesRead, source->content().size());
+                entry.hash = serializer::ParseCache::hashContent(source->content());
+                if (entry.hash == entries[i].hash) {
+                    entries[i].size = entry.size;
+                    entries[i].modified = entry.modified;
+                    continue;   // Mesmo conteúdo (touch, ou a nossa própria escrita)
+                }
+                parseContent(header, source->content(), entry);
+            } else if (entries[i].hash == 0) {
+                continue;   // Removido antes de ser visto
+            }
+
+            if (!entry.hasMacro && !entries[i].hasMacro) {
+                entries[i] = std::move(entry);
+                continue;   // Header sem SERIALIZABLE, antes e depois
+            }
+
+            std::cout << "\n🔄 " << (exists ? "Alterado: " : "Removido: ") << header.filename() << "\n";
 
-        // Gera arquivo de implementação
-        auto implFile = generator.generateImplFile(
-            classInfo,
-            generatedDir,
-            typeChecker
-        );
+            // Tira a versão antiga da classe; os dependentes dela também são regerados
+            const auto& old = entries[i].classInfo;
+            const auto oldId = old ? classes.find(old->name) : serializer::ClassTable::NONE;
+            if (oldId != serializer::ClassTable::NONE && classes.header(oldId) == header) {
+                touched.insert(old->name);
+                const auto& dependents = classes[oldId].dependents;
+                touched.insert(dependents.begin(), dependents.end());
 
-        if (!implFile) {
-            std::cout << "   ❌ Falha ao gerar implementação\n";
-            errors++;
+                typeChecker.unregisterSerializableClass(old->name);
+                classes.remove(oldId);
+            }
+
+            const std::string oldName = old ? old->name : "";
+            const auto oldOutputs = old ? generator.outputFiles(*old, generatedDir) : std::vector<fs::path>{};
+            entries[i] = std::move(entry);
+            if (registerClass(header, entries[i])) {
+                touched.insert(entries[i].classInfo->name);
+            } else if (!oldName.empty()) {
+                std::cout << "    ➖ " << oldName << " não é mais serializável\n";
+            }
+
+            // A classe sumiu (header removido, sem SERIALIZABLE ou renomeada): os arquivos
+            // gerados dela ficariam órfãos e continuariam sendo compilados
+            if (!oldName.empty() && classes.find(oldName) == serializer::ClassTable::NONE) {
+                for (const auto& stale : oldOutputs) {
+                    std::error_code ec;
+                    if (fs::remove(stale, ec)) {
+                        std::cout << "   🗑️  Removido: " << stale.filename().string() << "\n";
+                    }
+                }
+            }
+        }
+
+        if (touched.empty()) {
             continue;
         }
 
-        // Modifica classe original
-        auto originalFile = classToFileMap[classInfo.name];
-        if (generator.modifyOriginalClass(originalFile, classInfo)) {
-            processed++;
-            std::cout << "   ✅ Sucesso!\n";
-        } else {
-            errors++;
-            std::cout << "   ❌ Falha ao modificar classe\n";
+        // Mesma ordem da execução completa: por header
+        classes.sortByHeader();
+        analyzeAll(false);
+
+        // Fecha o conjunto pelos dependentes (transitivos), já com as dependências novas
+        std::vector<std::string> pending(touched.begin(), touched.end());
+        while (!pending.empty()) {
+            const std::string name = std::move(pending.back());
+            pending.pop_back();
+            if (const auto id = classes.find(name); id != serializer::ClassTable::NONE) {
+                for (const auto& dependent : classes[id].dependents) {
+                    if (touched.insert(dependent).second) pending.push_back(dependent);
+                }
+            }
         }
-    }
 
-    // Resumo
-    std::cout << "\n" << std::string(40, '=') << "\n";
-    std::cout << "📊 Resultado Final:\n";
-    std::cout << "   ✅ Processadas: " << processed << "\n";
-    std::cout << "   ❌ Erros: " << errors << "\n";
-    std::cout << "   📁 Total de classes: " << allClasses.size() << "\n";
-
-    if (processed > 0) {
-        std::cout << "\n🎉 Serialização gerada com sucesso!\n";
-        std::cout << "📁 Arquivos gerados em: " << generatedDir << "\n";
-        std::cout << "\n💡 Como usar nas suas classes:\n";
-        std::cout << "   #include \"sua_classe.h\"\n";
-        std::cout << "   \n";
-        std::cout << "   SuaClasse obj;\n";
-        std::cout << "   nlohmann::json json = obj.serialize();  // Para JSON\n";
-        std::cout << "   obj.deserialize(json);                 // De JSON\n";
-        std::cout << "   auto novo = SuaClasse::fromJson(json); // Factory method\n";
-    }
+        processed = 0;
+        errors = 0;
+        generateClasses(orderClasses(&touched, false));
+        saveCache();
+        if (errors == 0) {
+            writeBuildOutputs();
+        }
 
-    return errors > 0 ? 1 : 0;
+        std::cout << "\n✅ " << processed << " classe(s) regerada(s)";
+        if (errors > 0) std::cout << ", ❌ " << errors << " erro(s)";
+        reportProfile();
+        std::cout << "\n👀 Observando..." << std::endl;
+    }
 }
 
 /*
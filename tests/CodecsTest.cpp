@@ -0,0 +1,339 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+// Testes de ida e volta dos codecs gerados para examples/ e tests/model/:
+// JSON (DOM e streaming), binário (WireFormat), archives, lote colunar e
+// fluxos de registros, com entradas cortadas e malformadas em cada um.
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "BinaryArchive.h"
+#include "Columnar.h"
+#include "JsonReader.h"
+#include "JsonWriter.h"
+#include "RecordStream.h"
+#include "WireFormat.h"
+
+#include "ClassB_serialization_impl.h"
+#include "ClassA_serialization_impl.h"
+#include "Amostra_serialization_impl.h"
+
+namespace {
+    int falhas = 0;
+
+// assert some com NDEBUG: o teste precisa falhar também em Release
+#define CHECK(condicao)                                                                    \
+    do {                                                                                   \
+        if (!(condicao)) {                                                                 \
+            std::cerr << "❌ " << __FILE__ << ":" << __LINE__ << ": " << #condicao << "\n"; \
+            ++falhas;                                                                      \
+        }                                                                                  \
+    } while (false)
+
+    // true se f() lançar exatamente Erro (qualquer outra exceção conta como falha)
+    template<typename Erro, typename F>
+    bool lanca(F&& f) {
+        try {
+            f();
+        } catch (const Erro&) {
+            return true;
+        } catch (const std::exception& e) {
+            std::cerr << "   exceção inesperada: " << e.what() << "\n";
+            return false;
+        }
+        return false;
+    }
+
+    template<typename T>
+    std::string json(const T& obj) {
+        std::string out;
+        obj.writeJson(out);
+        return out;
+    }
+
+    ClassB itemB(int id) {
+        ClassB b{};
+        b.idClasseB = id;
+        return b;
+    }
+
+    Amostra exemplo() {
+        Amostra a{};
+        a.valor = -12.5;
+        a.grande = std::numeric_limits<int64_t>::min() + 7;
+        a.pequeno = 250;
+        a.ativo = true;
+        a.marcado = false;
+        a.texto = "linha\n\"aspas\" ç 😀";
+        a.medidas = {1.5, -0.25, 1e300};
+        a.flags = {true, false, true, true, false, false, true, false, true};
+        a.contagem = {{"a", 1}, {"b", -2}};
+        a.apelido = "apelido";
+        a.codigo = std::string("X-1");
+        a.itens = {itemB(1), itemB(-300000)};
+        return a;
+    }
+
+    ClassA exemploA() {
+        ClassA a{};
+        a.id = 42;
+        a.nome = "Bruno";
+        a.emails = {"a@b.c", ""};
+        a.class_b = itemB(7);
+        a.ativo = true;
+        return a;
+    }
+
+    void testJsonDom() {
+        const Amostra a = exemplo();
+        const nlohmann::json dom = a.serialize();
+        CHECK(json(Amostra::fromJson(dom)) == json(a));
+
+        // deserializeInto reaproveita a memória, mas o resultado é o mesmo
+        Amostra b = exemplo();
+        b.itens.resize(5);
+        b.deserializeInto(dom);
+        CHECK(json(b) == json(a));
+
+        // Chave ausente lança em vez de ler fora do objeto
+        const auto incompleto = nlohmann::json::parse(R"({"id":1})");
+        ClassA c{};
+        CHECK(lanca<nlohmann::json::out_of_range>([&] { c.deserialize(incompleto); }));
+        CHECK(lanca<nlohmann::json::out_of_range>([&] { c.deserializeInto(incompleto); }));
+    }
+
+    void testJsonStreaming() {
+        const Amostra a = exemplo();
+        const std::string texto = json(a);
+        CHECK(texto.size() <= a.serializedJsonSize());
+        CHECK(nlohmann::json::parse(texto) == a.serialize());
+
+        Amostra b{};
+        b.deserializeFrom(texto);
+        CHECK(json(b) == texto);
+
+        const ClassA classeA = exemploA();
+        ClassA outraA{};
+        outraA.deserializeFrom(json(classeA));
+        CHECK(json(outraA) == json(classeA));
+
+        // Todo prefixo próprio do documento é inválido
+        for (size_t n = 0; n < texto.size(); ++n) {
+            Amostra c{};
+            CHECK(lanca<serializer::JsonParseError>([&] { c.deserializeFrom(std::string_view(texto).substr(0, n)); }));
+        }
+    }
+
+    void testWire() {
+        const Amostra a = exemplo();
+        std::string bytes;
+        a.serializeBinary(bytes);
+        CHECK(bytes.size() == a.serializedSize());
+
+        Amostra b{};
+        b.deserializeBinary(bytes);
+        CHECK(json(b) == json(a));
+
+        const ClassA classeA = exemploA();
+        std::string bytesA;
+        classeA.serializeBinary(bytesA);
+        CHECK(bytesA.size() == classeA.serializedSize());
+
+        for (size_t n = 0; n < bytes.size(); ++n) {
+            Amostra c{};
+            CHECK(lanca<serializer::WireFormatError>([&] { c.deserializeBinary(std::string_view(bytes).substr(0, n)); }));
+        }
+        CHECK(lanca<serializer::WireFormatError>([&] { b.deserializeBinary(bytes + '\0'); }));
+    }
+
+    void testArchive() {
+        const Amostra a = exemplo();
+        serializer::ArchiveBuffer buffer(serializer::archiveSize(a));
+        serializer::BinaryOutputArchive out(buffer);
+        a.serialize(out);
+        CHECK(buffer.size() == serializer::archiveSize(a));
+        CHECK(buffer.size() == buffer.capacity());
+
+        Amostra b{};
+        serializer::BinaryInputArchive in(buffer.view());
+        b.deserialize(in);
+        CHECK(json(b) == json(a));
+        CHECK(in.remaining() == 0);
+
+        for (size_t n = 0; n < buffer.size(); ++n) {
+            Amostra c{};
+            serializer::BinaryInputArchive cortado(buffer.view().substr(0, n));
+            CHECK(lanca<serializer::ArchiveError>([&] { c.deserialize(cortado); }));
+        }
+
+        // Buffer movido fica vazio e pode ser usado de novo sem tocar no destino
+        serializer::ArchiveBuffer destino(std::move(buffer));
+        CHECK(buffer.size() == 0 && buffer.capacity() == 0);
+        const int x = 1;
+        buffer.append(&x, sizeof(x));
+        CHECK(buffer.data() != destino.data());
+    }
+
+    void testColumnar() {
+        std::vector<Amostra> linhas{exemplo(), Amostra{}, exemplo()};
+        linhas[2].flags.clear();
+        linhas[2].apelido.reset();
+        linhas[2].codigo = 5;
+
+        std::string texto;
+        serializer::writeColumnsJson(texto, linhas);
+        std::vector<Amostra> volta;
+        serializer::readColumnsJson(texto, volta);
+        CHECK(volta.size() == linhas.size());
+        for (size_t i = 0; i < volta.size() && i < linhas.size(); ++i) {
+            CHECK(json(volta[i]) == json(linhas[i]));
+        }
+
+        std::string bytes;
+        serializer::writeColumnsBinary(bytes, linhas);
+        std::vector<Amostra> voltaBinaria(7);
+        serializer::readColumnsBinary(bytes, voltaBinaria);
+        CHECK(voltaBinaria.size() == linhas.size());
+        for (size_t i = 0; i < voltaBinaria.size() && i < linhas.size(); ++i) {
+            CHECK(json(voltaBinaria[i]) == json(linhas[i]));
+        }
+
+        for (size_t n = 0; n < bytes.size(); ++n) {
+            std::vector<Amostra> cortado;
+            CHECK(lanca<serializer::WireFormatError>([&] {
+                serializer::readColumnsBinary(std::string_view(bytes).substr(0, n), cortado);
+            }));
+        }
+
+        // Contagem de linhas que a mensagem não comporta: recusada antes de construir as linhas
+        std::string absurdo;
+        serializer::WireWriter writer(absurdo);
+        writer.varint(uint64_t{1} << 40);
+        absurdo.append(64, '\0');
+        std::vector<Amostra> vazio;
+        CHECK(lanca<serializer::WireFormatError>([&] { serializer::readColumnsBinary(absurdo, vazio); }));
+        CHECK(vazio.empty());
+
+        // Coluna ausente não pode deixar o valor antigo nas linhas reaproveitadas
+        std::vector<ClassB> bs{itemB(1), itemB(2)};
+        CHECK(lanca<serializer::JsonParseError>([&] { serializer::readColumnsJson("{}", bs); }));
+    }
+
+    void testStreams() {
+        const std::vector<Amostra> registros{exemplo(), Amostra{}, exemplo()};
+
+        for (const auto formato : {serializer::RecordFormat::NdJson, serializer::RecordFormat::LengthPrefixed}) {
+            std::stringstream fluxo;
+            {
+                serializer::StreamWriter<Amostra> writer(fluxo, formato);
+                for (const auto& registro : registros) {
+                    writer.write(registro);
+                }
+            }
+            const std::string bytes = fluxo.str();
+
+            std::istringstream entrada(bytes);
+            serializer::StreamReader<Amostra> reader(entrada, formato, 16);
+            size_t lidos = 0;
+            for (const Amostra& registro : reader) {
+                CHECK(lidos < registros.size() && json(registro) == json(registros[lidos]));
+                ++lidos;
+            }
+            CHECK(lidos == registros.size());
+
+            // Fluxo cortado no meio do último registro
+            std::istringstream cortado(bytes.substr(0, bytes.size() - 3));
+            serializer::StreamReader<Amostra> readerCortado(cortado, formato);
+            const auto lerTudo = [&] {
+                for ([[maybe_unused]] const Amostra& registro : readerCortado) {}
+            };
+            if (formato == serializer::RecordFormat::NdJson) {
+                CHECK(lanca<serializer::JsonParseError>(lerTudo));
+            } else {
+                CHECK(lanca<serializer::RecordStreamError>(lerTudo));
+            }
+        }
+
+        // Prefixo de 10 bytes com bits acima do 63
+        std::istringstream prefixo(std::string("\x80\x80\x80\x80\x80\x80\x80\x80\x80\x02", 10));
+        serializer::StreamReader<ClassB> reader(prefixo, serializer::RecordFormat::LengthPrefixed);
+        ClassB b{};
+        CHECK(lanca<serializer::WireFormatError>([&] { reader.next(b); }));
+    }
+
+    void testEntradaMalformada() {
+        ClassB b{};
+
+        // Aninhamento profundo numa chave desconhecida: erro, não estouro de pilha
+        const std::string profundo = R"({"idClasseB":1,"zz":)" + std::string(200000, '[') +
+                                     std::string(200000, ']') + "}";
+        CHECK(lanca<serializer::JsonParseError>([&] { b.deserializeFrom(profundo); }));
+
+        // Campo ausente lança, como o json.at() do deserialize
+        CHECK(lanca<serializer::JsonParseError>([&] { b.deserializeFrom("{}"); }));
+
+        // Inteiro fora do intervalo do campo
+        Amostra a = exemplo();
+        std::string texto = json(a);
+        const std::string pequeno = "\"pequeno\":250";
+        CHECK(texto.find(pequeno) != std::string::npos);
+        texto.replace(texto.find(pequeno), pequeno.size(), "\"pequeno\":256");
+        CHECK(lanca<serializer::JsonParseError>([&] { a.deserializeFrom(texto); }));
+        CHECK(lanca<serializer::JsonParseError>([&] { b.deserializeFrom(R"({"idClasseB":1e40})"); }));
+
+        // Substitutos UTF-16 sem par
+        ClassA classeA = exemploA();
+        const std::string baseA = json(classeA);
+        for (const std::string_view escape : {R"(\ud83d)", R"(\ud83dA)", R"(\ude00)"}) {
+            std::string alterado = baseA;
+            alterado.replace(alterado.find("Bruno"), 5, escape);
+            CHECK(lanca<serializer::JsonParseError>([&] { classeA.deserializeFrom(alterado); }));
+        }
+
+        // Binário: varint maior que o campo e varint com mais de 64 bits
+        std::string bytes;
+        serializer::WireWriter writer(bytes);
+        writer.value(int64_t{1} << 40);
+        CHECK(lanca<serializer::WireFormatError>([&] { b.deserializeBinary(bytes); }));
+        CHECK(lanca<serializer::WireFormatError>([&] {
+            b.deserializeBinary(std::string("\xff\xff\xff\xff\xff\xff\xff\xff\xff\x7f", 10));
+        }));
+
+        // Archive: byte de bool diferente de 0/1
+        serializer::ArchiveBuffer buffer;
+        serializer::BinaryOutputArchive out(buffer);
+        classeA.serialize(out);
+        std::string corrompido(buffer.view());
+        corrompido.back() = 2;   // ativo é o último campo de ClassA
+        ClassA lido{};
+        serializer::BinaryInputArchive in(corrompido);
+        CHECK(lanca<serializer::ArchiveError>([&] { lido.deserialize(in); }));
+    }
+}
+
+int main() {
+    testJsonDom();
+    testJsonStreaming();
+    testWire();
+    testArchive();
+    testColumnar();
+    testStreams();
+    testEntradaMalformada();
+
+    if (falhas > 0) {
+        std::cerr << "❌ " << falhas << " verificação(ões) falharam\n";
+        return 1;
+    }
+    std::cout << "✅ Todos os testes passaram\n";
+    return 0;
+}
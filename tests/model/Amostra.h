@@ -0,0 +1,36 @@
+//
+// Created by bruno on 16/10/2026.
+//
+
+#ifndef CPP_SERIALIZER_AMOSTRA_H
+#define CPP_SERIALIZER_AMOSTRA_H
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "Macro.h"
+#include "ClassB.h"
+
+// Classe dos testes: um campo de cada família de tipo que os codecs tratam à parte
+SERIALIZABLE(Amostra)
+class Amostra {
+public:
+    double valor;
+    int64_t grande;
+    uint8_t pequeno;
+    bool ativo;
+    bool marcado;
+    std::string texto;
+    std::vector<double> medidas;
+    std::vector<bool> flags;
+    std::map<std::string, int> contagem;
+    std::optional<std::string> apelido;
+    std::variant<int, std::string> codigo;
+    std::vector<ClassB> itens;
+};
+
+#endif //CPP_SERIALIZER_AMOSTRA_H